@@ -0,0 +1,62 @@
+#!/usr/bin/env python3
+"""Compares two Google Benchmark JSON reports and flags slowdowns.
+
+Usage: bench_compare.py BASELINE.json CONTENDER.json [--threshold PERCENT]
+
+Exits with status 1 when any benchmark present in both reports got slower
+than the threshold (5% by default).
+"""
+import argparse
+import json
+import sys
+
+
+def load(path):
+    with open(path) as f:
+        report = json.load(f)
+    times = {}
+    for bench in report["benchmarks"]:
+        # With --benchmark_repetitions keep only the mean aggregate
+        if bench.get("run_type") == "aggregate":
+            if bench.get("aggregate_name") != "mean":
+                continue
+            name = bench["run_name"]
+        elif "run_name" in bench and bench.get("repetitions", 1) > 1:
+            continue
+        else:
+            name = bench["name"]
+        times[name] = bench["real_time"]
+    return times
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline")
+    parser.add_argument("contender")
+    parser.add_argument("--threshold", type=float, default=5.0,
+                        help="allowed slowdown in percent (default: 5)")
+    args = parser.parse_args()
+
+    old = load(args.baseline)
+    new = load(args.contender)
+    regressions = 0
+    for name in sorted(old.keys() & new.keys()):
+        change = (new[name] - old[name]) / old[name] * 100.0
+        flag = ""
+        if change > args.threshold:
+            flag = "  <-- SLOWER"
+            regressions += 1
+        print(f"{name:<60} {old[name]:>14.1f} {new[name]:>14.1f} "
+              f"{change:>+8.1f}%{flag}")
+    for name in sorted(old.keys() - new.keys()):
+        print(f"{name:<60} missing from {args.contender}")
+
+    if regressions:
+        print(f"\n{regressions} benchmark(s) slower by more than "
+              f"{args.threshold:g}%")
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,1031 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <list>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "s21_concurrent_list.h"
+#include "s21_indexed_list.h"
+#include "s21_intrusive_list.h"
+#include "s21_list.h"
+#include "s21_small_list.h"
+#include "s21_unrolled_list.h"
+
+#ifndef BENCH_MAX_SIZE
+#define BENCH_MAX_SIZE 10000000
+#endif
+
+// Calls of operator new on this thread, read before and after a timed loop
+// to report heap allocations per iteration. Per thread, so the concurrent
+// benchmarks do not contend on it.
+static thread_local std::uint64_t g_allocations = 0;
+
+void* operator new(std::size_t size) {
+  g_allocations++;
+  if (void* memory = std::malloc(size ? size : 1)) return memory;
+  throw std::bad_alloc();
+}
+// GCC cannot tell that these pair with the operator new above
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t) noexcept {
+  std::free(memory);
+}
+#pragma GCC diagnostic pop
+
+namespace {
+
+struct Pod64 {
+  std::uint64_t key;
+  char payload[56];
+};
+
+bool operator<(const Pod64& a, const Pod64& b) { return a.key < b.key; }
+bool operator==(const Pod64& a, const Pod64& b) { return a.key == b.key; }
+
+template <typename T>
+T make_value(std::uint64_t i);
+
+template <>
+int make_value<int>(std::uint64_t i) {
+  return static_cast<int>(i);
+}
+
+template <>
+float make_value<float>(std::uint64_t i) {
+  return static_cast<float>(i);
+}
+
+template <>
+Pod64 make_value<Pod64>(std::uint64_t i) {
+  Pod64 value{};
+  value.key = i;
+  return value;
+}
+
+// Reads the whole value, so a Pod64 node costs both of its cache lines
+std::int64_t checksum(int value) { return value; }
+std::int64_t checksum(const Pod64& value) {
+  return static_cast<std::int64_t>(value.key) + value.payload[55];
+}
+
+// Long enough to defeat the small string optimisation
+template <>
+std::string make_value<std::string>(std::uint64_t i) {
+  return "benchmark_payload_" + std::to_string(i);
+}
+
+// 1 KiB heap payload ordered by its first element, expensive to copy
+template <>
+std::vector<int> make_value<std::vector<int>>(std::uint64_t i) {
+  std::vector<int> value(256);
+  value[0] = static_cast<int>(i);
+  return value;
+}
+
+// Deterministic pseudo-random keys, the same for every container
+std::uint64_t scramble(std::uint64_t i) {
+  return (i * 0x9E3779B97F4A7C15ULL) >> 40;
+}
+
+template <typename List>
+void fill(List& list, std::int64_t n, bool shuffled = false) {
+  using T = typename List::value_type;
+  for (std::int64_t i = 0; i < n; i++) {
+    auto key = static_cast<std::uint64_t>(i);
+    list.push_back(make_value<T>(shuffled ? scramble(key) : key));
+  }
+}
+
+template <typename List>
+void BM_push_back(benchmark::State& state) {
+  using T = typename List::value_type;
+  const std::int64_t n = state.range(0);
+  for (auto _ : state) {
+    List list;
+    for (std::int64_t i = 0; i < n; i++) {
+      list.push_back(make_value<T>(static_cast<std::uint64_t>(i)));
+    }
+    benchmark::DoNotOptimize(list);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename List>
+void BM_push_front(benchmark::State& state) {
+  using T = typename List::value_type;
+  const std::int64_t n = state.range(0);
+  for (auto _ : state) {
+    List list;
+    for (std::int64_t i = 0; i < n; i++) {
+      list.push_front(make_value<T>(static_cast<std::uint64_t>(i)));
+    }
+    benchmark::DoNotOptimize(list);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+// Bulk load from a prepared buffer, against the push_back loop above
+template <typename List>
+void BM_range_construct(benchmark::State& state) {
+  using T = typename List::value_type;
+  const std::int64_t n = state.range(0);
+  std::vector<T> source;
+  source.reserve(static_cast<std::size_t>(n));
+  for (std::int64_t i = 0; i < n; i++) {
+    source.push_back(make_value<T>(static_cast<std::uint64_t>(i)));
+  }
+  for (auto _ : state) {
+    List list(source.begin(), source.end());
+    benchmark::DoNotOptimize(list);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+// Reassigning a snapshot every tick: range(1) is the old size of the target
+// in percent of the new one (equal, growing and shrinking)
+template <typename List>
+void BM_copy_assign(benchmark::State& state) {
+  const std::int64_t n = state.range(0);
+  List source;
+  fill(source, n);
+  List target;
+  fill(target, n * state.range(1) / 100);
+  List snapshot = target;
+  for (auto _ : state) {
+    target = source;
+    benchmark::DoNotOptimize(target);
+    state.PauseTiming();
+    target = snapshot;
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename List>
+void BM_pop(benchmark::State& state) {
+  const std::int64_t n = state.range(0);
+  for (auto _ : state) {
+    state.PauseTiming();
+    List list;
+    fill(list, n);
+    state.ResumeTiming();
+    while (!list.empty()) {
+      list.pop_back();
+      if (!list.empty()) list.pop_front();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename List>
+void BM_insert_middle(benchmark::State& state) {
+  using T = typename List::value_type;
+  const std::int64_t n = state.range(0);
+  for (auto _ : state) {
+    List list;
+    list.push_back(make_value<T>(0));
+    list.push_back(make_value<T>(1));
+    auto pos = list.begin();
+    ++pos;
+    for (std::int64_t i = 0; i < n; i++) {
+      list.insert(pos, make_value<T>(static_cast<std::uint64_t>(i)));
+      if (i & 1) --pos;
+    }
+    benchmark::DoNotOptimize(list);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+// A short-lived list of n elements, as built per request. The allocs
+// counter is zero for small_list while n fits its inline nodes.
+template <typename List>
+void BM_small_lifetime(benchmark::State& state) {
+  using T = typename List::value_type;
+  const std::int64_t n = state.range(0);
+  const std::uint64_t before = g_allocations;
+  for (auto _ : state) {
+    List list;
+    for (std::int64_t i = 0; i < n; i++) {
+      list.push_back(make_value<T>(static_cast<std::uint64_t>(i)));
+    }
+    list.pop_front();
+    benchmark::DoNotOptimize(list);
+  }
+  state.counters["allocs"] = benchmark::Counter(
+      static_cast<double>(g_allocations - before),
+      benchmark::Counter::kAvgIterations);
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+// A task migrating between two priority lists of 1000: erase and
+// push_back (mode 0), extract and insert of the node handle (mode 1), or
+// splice (mode 2). Items are migrations.
+template <typename List>
+void BM_migrate(benchmark::State& state) {
+  List lists[2];
+  fill(lists[0], 1000);
+  fill(lists[1], 1000);
+  const std::uint64_t before = g_allocations;
+  std::size_t from = 0;
+  for (auto _ : state) {
+    List& source = lists[from];
+    List& target = lists[1 - from];
+    switch (state.range(0)) {
+      case 0:
+        target.push_back(std::move(source.front()));
+        source.pop_front();
+        break;
+      case 1:
+        target.insert(target.end(), source.extract(source.begin()));
+        break;
+      default:
+        target.splice(target.end(), source, source.begin());
+    }
+    from = 1 - from;
+    benchmark::DoNotOptimize(target);
+  }
+  state.counters["allocs"] = benchmark::Counter(
+      static_cast<double>(g_allocations - before),
+      benchmark::Counter::kAvgIterations);
+  state.SetItemsProcessed(state.iterations());
+}
+
+// A request-scoped list: built, walked once and destroyed. Mode 0 uses
+// std::allocator, mode 1 a monotonic_buffer_resource over a buffer kept
+// between requests (destruction then skips the per-node frees), mode 2 a
+// long-lived unsynchronized_pool_resource shared by every request.
+template <typename T>
+void BM_request_scoped(benchmark::State& state) {
+  const std::int64_t n = state.range(0);
+  std::vector<std::byte> buffer(static_cast<std::size_t>(n) *
+                                (sizeof(T) + 2 * sizeof(void*)));
+  std::pmr::unsynchronized_pool_resource pool;
+  for (auto _ : state) {
+    auto run = [&](auto& list) {
+      for (std::int64_t i = 0; i < n; i++) {
+        list.push_back(make_value<T>(static_cast<std::uint64_t>(i)));
+      }
+      std::int64_t sum = 0;
+      for (const T& value : list) sum += checksum(value);
+      benchmark::DoNotOptimize(sum);
+    };
+    if (state.range(1) == 0) {
+      s21::list<T> list;
+      run(list);
+    } else if (state.range(1) == 1) {
+      std::pmr::monotonic_buffer_resource request(buffer.data(),
+                                                  buffer.size());
+      s21::pmr::list<T> list(&request);
+      run(list);
+    } else {
+      s21::pmr::list<T> list(&pool);
+      run(list);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+// Element at a pseudo-random rank: at() on indexed_list, a walk from
+// begin() on the plain lists
+template <typename List>
+auto& nth(List& list, std::int64_t k) {
+  if constexpr (std::is_same_v<List, s21::indexed_list<int>>) {
+    return list.at(static_cast<std::size_t>(k));
+  } else {
+    return *std::next(list.begin(), static_cast<std::ptrdiff_t>(k));
+  }
+}
+
+template <typename List>
+void BM_at_rank(benchmark::State& state) {
+  const std::int64_t n = state.range(0);
+  List list;
+  fill(list, n);
+  std::uint64_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        nth(list, static_cast<std::int64_t>(scramble(i++) % n)));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Grows a list to n elements, each inserted at a pseudo-random rank
+template <typename List>
+void BM_insert_at_rank(benchmark::State& state) {
+  const std::int64_t n = state.range(0);
+  for (auto _ : state) {
+    List list;
+    for (std::int64_t i = 0; i < n; i++) {
+      const auto k = static_cast<std::int64_t>(
+          scramble(static_cast<std::uint64_t>(i)) % (i + 1));
+      if constexpr (std::is_same_v<List, s21::indexed_list<int>>) {
+        list.insert_at(static_cast<std::size_t>(k), static_cast<int>(i));
+      } else {
+        list.insert(std::next(list.begin(), static_cast<std::ptrdiff_t>(k)),
+                    static_cast<int>(i));
+      }
+    }
+    benchmark::DoNotOptimize(list);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename List>
+void BM_erase(benchmark::State& state) {
+  const std::int64_t n = state.range(0);
+  for (auto _ : state) {
+    state.PauseTiming();
+    List list;
+    fill(list, n);
+    state.ResumeTiming();
+    auto it = list.begin();
+    while (it != list.end()) {
+      auto next = it;
+      ++next;
+      list.erase(it);
+      it = next;
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename List>
+void BM_sort(benchmark::State& state) {
+  const std::int64_t n = state.range(0);
+  for (auto _ : state) {
+    state.PauseTiming();
+    List list;
+    fill(list, n, true);
+    state.ResumeTiming();
+    list.sort();
+    benchmark::DoNotOptimize(list);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename List>
+void BM_merge(benchmark::State& state) {
+  using T = typename List::value_type;
+  const std::int64_t n = state.range(0);
+  for (auto _ : state) {
+    state.PauseTiming();
+    List left;
+    List right;
+    for (std::int64_t i = 0; i < n; i++) {
+      auto key = static_cast<std::uint64_t>(i);
+      (i & 1 ? right : left).push_back(make_value<T>(key));
+    }
+    state.ResumeTiming();
+    left.merge(right);
+    benchmark::DoNotOptimize(left);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+// sort, merge and unique only relink, so with a heap payload the allocs
+// counter (operator new calls inside the timed region) stays at zero
+template <typename List>
+void BM_sort_merge_heavy(benchmark::State& state) {
+  const std::int64_t n = state.range(0);
+  std::uint64_t allocations = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    List list;
+    List other;
+    fill(list, n, true);
+    fill(other, n, true);
+    state.ResumeTiming();
+    const std::uint64_t before = g_allocations;
+    list.sort();
+    other.sort();
+    list.merge(other);
+    list.unique();
+    allocations += g_allocations - before;
+    benchmark::DoNotOptimize(list);
+  }
+  state.counters["allocs"] = benchmark::Counter(
+      static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+  state.SetItemsProcessed(state.iterations() * n * 2);
+}
+
+template <typename List>
+void BM_splice(benchmark::State& state) {
+  const std::int64_t n = state.range(0);
+  List left;
+  List right;
+  fill(left, n);
+  fill(right, n);
+  for (auto _ : state) {
+    right.splice(right.begin(), left);
+    left.swap(right);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename List>
+void BM_unique(benchmark::State& state) {
+  using T = typename List::value_type;
+  const std::int64_t n = state.range(0);
+  for (auto _ : state) {
+    state.PauseTiming();
+    List list;
+    for (std::int64_t i = 0; i < n; i++) {
+      list.push_back(make_value<T>(static_cast<std::uint64_t>(i / 2)));
+    }
+    state.ResumeTiming();
+    list.unique();
+    benchmark::DoNotOptimize(list);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+// About four copies of each value, scattered through the list
+template <typename List>
+void fill_duplicates(List& list, std::int64_t n) {
+  using T = typename List::value_type;
+  const auto distinct = static_cast<std::uint64_t>(n / 4 + 1);
+  for (std::int64_t i = 0; i < n; i++) {
+    list.push_back(make_value<T>(scramble(static_cast<std::uint64_t>(i)) %
+                                 distinct));
+  }
+}
+
+template <typename List>
+void BM_dedupe(benchmark::State& state) {
+  const std::int64_t n = state.range(0);
+  for (auto _ : state) {
+    state.PauseTiming();
+    List list;
+    fill_duplicates(list, n);
+    state.ResumeTiming();
+    list.dedupe();
+    benchmark::DoNotOptimize(list);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+// What dedupe replaces: sort, then drop the now adjacent duplicates
+template <typename List>
+void BM_sort_unique(benchmark::State& state) {
+  const std::int64_t n = state.range(0);
+  for (auto _ : state) {
+    state.PauseTiming();
+    List list;
+    fill_duplicates(list, n);
+    state.ResumeTiming();
+    list.sort();
+    list.unique();
+    benchmark::DoNotOptimize(list);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename List>
+void BM_remove_if(benchmark::State& state) {
+  using T = typename List::value_type;
+  const std::int64_t n = state.range(0);
+  const T pivot = make_value<T>(static_cast<std::uint64_t>(n / 4));
+  for (auto _ : state) {
+    state.PauseTiming();
+    List list;
+    fill_duplicates(list, n);
+    state.ResumeTiming();
+    list.remove_if([&pivot](const T& item) { return item < pivot; });
+    benchmark::DoNotOptimize(list);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename List>
+void BM_reverse(benchmark::State& state) {
+  const std::int64_t n = state.range(0);
+  List list;
+  fill(list, n);
+  for (auto _ : state) {
+    list.reverse();
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+// Consuming a list back to front: reverse() and a forward walk (mode 0)
+// against walking rbegin()..rend() with the links left alone (mode 1)
+template <typename List>
+void BM_consume_backwards(benchmark::State& state) {
+  const std::int64_t n = state.range(0);
+  List list;
+  fill(list, n);
+  for (auto _ : state) {
+    std::int64_t sum = 0;
+    if (state.range(1) == 0) {
+      list.reverse();
+      for (auto it = list.begin(); it != list.end(); ++it) sum += checksum(*it);
+    } else {
+      for (auto it = list.rbegin(); it != list.rend(); ++it) {
+        sum += checksum(*it);
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename List>
+void BM_iterate(benchmark::State& state) {
+  const std::int64_t n = state.range(0);
+  List list;
+  fill(list, n);
+  for (auto _ : state) {
+    std::int64_t visited = 0;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+      benchmark::DoNotOptimize(*it);
+      visited++;
+    }
+    benchmark::DoNotOptimize(visited);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+// Erases a pseudo-random half of a fresh list, then inserts as many
+// elements before pseudo-random survivors: the long-lived churn that leaves
+// consecutive elements far apart in memory
+template <typename List>
+void fragment(List& list, std::int64_t n) {
+  using T = typename List::value_type;
+  fill(list, n);
+  std::vector<typename List::iterator> nodes;
+  for (auto it = list.begin(); it != list.end(); ++it) nodes.push_back(it);
+  for (std::size_t i = nodes.size(); i > 1; i--) {
+    std::swap(nodes[i - 1], nodes[scramble(i) % i]);
+  }
+  const std::size_t half = nodes.size() / 2;
+  for (std::size_t i = 0; i < half; i++) list.erase(nodes[i]);
+  for (std::size_t i = 0; i < half; i++) {
+    auto pos = nodes[half + scramble(i) % (nodes.size() - half)];
+    list.insert(pos, make_value<T>(i));
+  }
+}
+
+// Iteration over a fresh list (mode 0), the same list after fragment()
+// (mode 1) and after fragment() and compact() (mode 2)
+template <typename List>
+void BM_iterate_fragmented(benchmark::State& state) {
+  const std::int64_t n = state.range(0);
+  List list;
+  if (state.range(1) == 0) {
+    fill(list, n);
+  } else {
+    fragment(list, n);
+  }
+  if constexpr (!std::is_same_v<List, std::list<int>>) {
+    if (state.range(1) == 2) list.compact();
+  }
+  for (auto _ : state) {
+    std::int64_t sum = 0;
+    for (auto it = list.begin(); it != list.end(); ++it) sum += *it;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+// Caller-owned objects linked through an embedded hook, compared with the
+// Summing a fragment()-ed list by hand (mode 0), with for_each (1),
+// accumulate (2) and 16-element for_each_batch (3). From 10^6 nodes on the
+// list no longer fits in cache, so every pass starts cold. Build with
+// -DS21_LIST_PREFETCH_DISTANCE=8 to time the helpers with prefetching.
+template <typename List>
+void BM_scan_fragmented(benchmark::State& state) {
+  using T = typename List::value_type;
+  const std::int64_t n = state.range(0);
+  List list;
+  fragment(list, n);
+  auto add = [](std::int64_t sum, const T& value) {
+    return sum + checksum(value);
+  };
+  for (auto _ : state) {
+    std::int64_t sum = 0;
+    switch (state.range(1)) {
+      case 0:
+        for (auto it = list.begin(); it != list.end(); ++it) {
+          sum = add(sum, *it);
+        }
+        break;
+      case 1:
+        list.for_each([&](const T& value) { sum = add(sum, value); });
+        break;
+      case 2:
+        sum = list.accumulate(sum, add);
+        break;
+      default:
+        list.for_each_batch(16, [&](T* const* items, std::size_t count) {
+          for (std::size_t i = 0; i < count; i++) sum = add(sum, *items[i]);
+        });
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+// Searching for a missing value with an iterator loop (mode 0) and with
+// find() (mode 1), which compares blocks of values with SIMD instructions
+template <typename List>
+void BM_find_missing(benchmark::State& state) {
+  using T = typename List::value_type;
+  const std::int64_t n = state.range(0);
+  List list;
+  fill(list, n);
+  const T missing = make_value<T>(static_cast<std::uint64_t>(n) + 1);
+  for (auto _ : state) {
+    bool found = false;
+    if (state.range(1) == 0) {
+      for (auto it = list.begin(); it != list.end() && !found; ++it) {
+        found = *it == missing;
+      }
+    } else {
+      found = list.find(missing) != list.end();
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+// Comparing two equal lists element by element (mode 0) and with ==
+template <typename List>
+void BM_equal(benchmark::State& state) {
+  const std::int64_t n = state.range(0);
+  List a;
+  List b;
+  fill(a, n);
+  fill(b, n);
+  for (auto _ : state) {
+    bool equal = true;
+    if (state.range(1) == 0) {
+      auto it = b.begin();
+      for (auto value = a.begin(); value != a.end() && equal; ++value, ++it) {
+        equal = *value == *it;
+      }
+    } else {
+      equal = a == b;
+    }
+    benchmark::DoNotOptimize(equal);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+// Pod64 runs of the owning list above
+struct HookedPod64 {
+  Pod64 value;
+  s21::list_hook hook;
+};
+
+bool operator<(const HookedPod64& a, const HookedPod64& b) {
+  return a.value < b.value;
+}
+
+using hooked_list = s21::intrusive_list<HookedPod64, &HookedPod64::hook>;
+
+std::vector<HookedPod64> make_hooked(std::int64_t n, bool shuffled = false) {
+  std::vector<HookedPod64> items(static_cast<std::size_t>(n));
+  for (std::int64_t i = 0; i < n; i++) {
+    auto key = static_cast<std::uint64_t>(i);
+    items[i].value = make_value<Pod64>(shuffled ? scramble(key) : key);
+  }
+  return items;
+}
+
+void BM_intrusive_push_back(benchmark::State& state) {
+  auto items = make_hooked(state.range(0));
+  for (auto _ : state) {
+    hooked_list list;
+    for (HookedPod64& item : items) list.push_back(item);
+    benchmark::DoNotOptimize(list);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_intrusive_iterate(benchmark::State& state) {
+  auto items = make_hooked(state.range(0));
+  hooked_list list;
+  for (HookedPod64& item : items) list.push_back(item);
+  for (auto _ : state) {
+    for (HookedPod64& item : list) benchmark::DoNotOptimize(item.value);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_intrusive_sort(benchmark::State& state) {
+  auto items = make_hooked(state.range(0), true);
+  for (auto _ : state) {
+    state.PauseTiming();
+    hooked_list list;
+    for (HookedPod64& item : items) list.push_back(item);
+    state.ResumeTiming();
+    list.sort();
+    benchmark::DoNotOptimize(list);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Restart: reload a saved list of ints from a file. The baseline reads and
+// push_backs one element at a time.
+const char* const kRestartFile = "list_bench_restart.bin";
+
+void save_restart_file(std::int64_t n) {
+  s21::list<int> list;
+  fill(list, n);
+  std::ofstream file(kRestartFile, std::ios::binary);
+  list.save(file);
+}
+
+void BM_restart_push_back(benchmark::State& state) {
+  save_restart_file(state.range(0));
+  for (auto _ : state) {
+    std::ifstream file(kRestartFile, std::ios::binary);
+    file.ignore(sizeof(s21::detail::list_file_header));
+    s21::list<int> list;
+    int value = 0;
+    while (file.read(reinterpret_cast<char*>(&value), sizeof(value))) {
+      list.push_back(value);
+    }
+    benchmark::DoNotOptimize(list);
+  }
+  std::remove(kRestartFile);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_restart_load(benchmark::State& state) {
+  save_restart_file(state.range(0));
+  for (auto _ : state) {
+    std::ifstream file(kRestartFile, std::ios::binary);
+    s21::list<int> list;
+    list.load(file);
+    benchmark::DoNotOptimize(list);
+  }
+  std::remove(kRestartFile);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename List>
+void BM_restart_load_mapped(benchmark::State& state) {
+  save_restart_file(state.range(0));
+  for (auto _ : state) {
+    List list;
+    list.load_mapped(kRestartFile);
+    benchmark::DoNotOptimize(list);
+  }
+  std::remove(kRestartFile);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Serial sort against the parallel one; threads:1 takes the serial path
+void BM_sort_parallel(benchmark::State& state) {
+  const std::int64_t n = state.range(0);
+  const auto threads = static_cast<unsigned>(state.range(1));
+  for (auto _ : state) {
+    state.PauseTiming();
+    s21::list<int> list;
+    fill(list, n, true);
+    state.ResumeTiming();
+    list.sort(s21::execution::par.with_threads(threads));
+    benchmark::DoNotOptimize(list);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+// s21::list behind one mutex, the baseline for concurrent_list
+class locked_list {
+ public:
+  void push_back(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    list_.push_back(value);
+  }
+  bool try_pop(int& value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (list_.empty()) return false;
+    value = list_.front();
+    list_.pop_front();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::list<int> list_;
+};
+
+// Every thread pushes and pops on one shared queue
+void BM_queue_concurrent(benchmark::State& state) {
+  static s21::concurrent_list<int> queue;
+  for (auto _ : state) {
+    queue.push_back(state.thread_index());
+    benchmark::DoNotOptimize(queue.try_pop());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_queue_locked(benchmark::State& state) {
+  static locked_list queue;
+  for (auto _ : state) {
+    int value = 0;
+    queue.push_back(state.thread_index());
+    benchmark::DoNotOptimize(queue.try_pop(value));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void sizes(benchmark::internal::Benchmark* bench) {
+  for (std::int64_t n = 10; n <= BENCH_MAX_SIZE; n *= 10) bench->Arg(n);
+}
+
+// Walking to a rank is O(n), so the plain lists stop at 10^4 elements
+void rank_sizes(benchmark::internal::Benchmark* bench) {
+  const std::int64_t max = std::min<std::int64_t>(BENCH_MAX_SIZE, 10000);
+  for (std::int64_t n = 10; n <= max; n *= 10) bench->Arg(n);
+}
+
+// Two lists of 1 KiB payloads per run
+void heavy_sizes(benchmark::internal::Benchmark* bench) {
+  const std::int64_t max = std::min<std::int64_t>(BENCH_MAX_SIZE, 10000);
+  for (std::int64_t n = 10; n <= max; n *= 10) bench->Arg(n);
+}
+
+void fragment_modes(benchmark::internal::Benchmark* bench) {
+  for (std::int64_t n = 1000; n <= BENCH_MAX_SIZE; n *= 10) {
+    for (std::int64_t mode : {0, 1, 2}) bench->Args({n, mode});
+  }
+  bench->ArgNames({"n", "mode"});
+}
+
+void scan_modes(benchmark::internal::Benchmark* bench) {
+  for (std::int64_t n = 100000; n <= BENCH_MAX_SIZE; n *= 10) {
+    for (std::int64_t mode : {0, 1, 2, 3}) bench->Args({n, mode});
+  }
+  bench->ArgNames({"n", "mode"});
+}
+
+void kernel_modes(benchmark::internal::Benchmark* bench) {
+  for (std::int64_t n = 1000; n <= BENCH_MAX_SIZE; n *= 10) {
+    for (std::int64_t mode : {0, 1}) bench->Args({n, mode});
+  }
+  bench->ArgNames({"n", "mode"});
+}
+
+void assign_sizes(benchmark::internal::Benchmark* bench) {
+  const std::int64_t max = std::min<std::int64_t>(BENCH_MAX_SIZE, 100000);
+  for (std::int64_t n = 100; n <= max; n *= 10) {
+    for (std::int64_t percent : {50, 100, 200}) bench->Args({n, percent});
+  }
+}
+
+}  // namespace
+
+// Every operation runs over s21::list and std::list side by side, for int,
+// a 64-byte POD and a heap-allocated std::string payload.
+#define S21_BENCH_TYPE(name, type)                         \
+  BENCHMARK_TEMPLATE(name, s21::list<type>)->Apply(sizes); \
+  BENCHMARK_TEMPLATE(name, std::list<type>)->Apply(sizes);
+#define S21_BENCH(name)     \
+  S21_BENCH_TYPE(name, int) \
+  S21_BENCH_TYPE(name, Pod64) S21_BENCH_TYPE(name, std::string)
+
+S21_BENCH(BM_push_back)
+S21_BENCH(BM_push_front)
+S21_BENCH(BM_range_construct)
+S21_BENCH(BM_pop)
+S21_BENCH(BM_insert_middle)
+S21_BENCH(BM_erase)
+S21_BENCH(BM_sort)
+S21_BENCH(BM_merge)
+S21_BENCH(BM_splice)
+S21_BENCH(BM_unique)
+S21_BENCH(BM_remove_if)
+S21_BENCH(BM_reverse)
+S21_BENCH(BM_iterate)
+
+#define S21_BENCH_ASSIGN(type)                                              \
+  BENCHMARK_TEMPLATE(BM_copy_assign, s21::list<type>)->Apply(assign_sizes); \
+  BENCHMARK_TEMPLATE(BM_copy_assign, std::list<type>)->Apply(assign_sizes);
+S21_BENCH_ASSIGN(int)
+S21_BENCH_ASSIGN(std::string)
+
+// Chunked storage against the one-node-per-element lists above
+BENCHMARK_TEMPLATE(BM_push_back, s21::unrolled_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_iterate, s21::unrolled_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_iterate, s21::unrolled_list<Pod64>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_sort, s21::unrolled_list<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(BM_iterate_fragmented, s21::list<int>)
+    ->Apply(fragment_modes);
+BENCHMARK_TEMPLATE(BM_iterate_fragmented,
+                   s21::list<int, s21::node_pool_allocator<int>>)
+    ->Apply(fragment_modes);
+BENCHMARK_TEMPLATE(BM_iterate_fragmented, std::list<int>)
+    ->ArgsProduct({benchmark::CreateRange(
+                       std::min<std::int64_t>(1000, BENCH_MAX_SIZE),
+                       BENCH_MAX_SIZE, 10),
+                   {0, 1}})
+    ->ArgNames({"n", "mode"});
+
+BENCHMARK_TEMPLATE(BM_scan_fragmented, s21::list<int>)->Apply(scan_modes);
+BENCHMARK_TEMPLATE(BM_scan_fragmented, s21::list<Pod64>)->Apply(scan_modes);
+
+// The kernels on heap nodes and on nodes from one pool, which are adjacent
+#define S21_BENCH_KERNELS(type)                                     \
+  BENCHMARK_TEMPLATE(BM_find_missing, s21::list<type>)              \
+      ->Apply(kernel_modes);                                        \
+  BENCHMARK_TEMPLATE(BM_find_missing,                               \
+                     s21::list<type, s21::node_pool_allocator<type>>) \
+      ->Apply(kernel_modes);                                        \
+  BENCHMARK_TEMPLATE(BM_equal, s21::list<type>)->Apply(kernel_modes);
+S21_BENCH_KERNELS(int)
+S21_BENCH_KERNELS(float)
+
+BENCHMARK_TEMPLATE(BM_migrate, s21::list<int>)->DenseRange(0, 2);
+BENCHMARK_TEMPLATE(BM_migrate, s21::list<std::string>)->DenseRange(0, 2);
+BENCHMARK_TEMPLATE(BM_migrate, s21::list<int, s21::node_pool_allocator<int>>)
+    ->DenseRange(0, 2);
+
+BENCHMARK_TEMPLATE(BM_request_scoped, int)
+    ->ArgsProduct({benchmark::CreateRange(
+                       std::min<std::int64_t>(100, BENCH_MAX_SIZE),
+                       BENCH_MAX_SIZE, 100),
+                   {0, 1, 2}})
+    ->ArgNames({"n", "mode"});
+BENCHMARK_TEMPLATE(BM_request_scoped, Pod64)
+    ->ArgsProduct({benchmark::CreateRange(
+                       std::min<std::int64_t>(100, BENCH_MAX_SIZE),
+                       BENCH_MAX_SIZE, 100),
+                   {0, 1, 2}})
+    ->ArgNames({"n", "mode"});
+
+BENCHMARK_TEMPLATE(BM_consume_backwards, s21::list<int>)
+    ->Apply(kernel_modes);
+BENCHMARK_TEMPLATE(BM_consume_backwards, s21::list<Pod64>)
+    ->Apply(kernel_modes);
+BENCHMARK_TEMPLATE(BM_consume_backwards, std::list<int>)
+    ->Apply(kernel_modes);
+
+#define S21_BENCH_HEAVY(type)                              \
+  BENCHMARK_TEMPLATE(BM_sort_merge_heavy, s21::list<type>) \
+      ->Apply(heavy_sizes);                                \
+  BENCHMARK_TEMPLATE(BM_sort_merge_heavy, std::list<type>) \
+      ->Apply(heavy_sizes);
+S21_BENCH_HEAVY(std::string)
+S21_BENCH_HEAVY(std::vector<int>)
+
+#define S21_BENCH_SMALL(type)                                      \
+  BENCHMARK_TEMPLATE(BM_small_lifetime, s21::small_list<type, 16>) \
+      ->DenseRange(4, 32, 4);                                      \
+  BENCHMARK_TEMPLATE(BM_small_lifetime, s21::list<type>)           \
+      ->DenseRange(4, 32, 4);                                      \
+  BENCHMARK_TEMPLATE(BM_small_lifetime, std::list<type>)->DenseRange(4, 32, 4);
+S21_BENCH_SMALL(int)
+S21_BENCH_SMALL(Pod64)
+
+BENCHMARK_TEMPLATE(BM_at_rank, s21::indexed_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_at_rank, s21::list<int>)->Apply(rank_sizes);
+BENCHMARK_TEMPLATE(BM_insert_at_rank, s21::indexed_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_insert_at_rank, s21::list<int>)->Apply(rank_sizes);
+
+// Hash dedupe needs std::hash, so no Pod64 here
+BENCHMARK_TEMPLATE(BM_dedupe, s21::list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_sort_unique, s21::list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_sort_unique, std::list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_dedupe, s21::list<std::string>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_sort_unique, s21::list<std::string>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_sort_unique, std::list<std::string>)->Apply(sizes);
+
+BENCHMARK(BM_intrusive_push_back)->Apply(sizes);
+BENCHMARK(BM_intrusive_iterate)->Apply(sizes);
+BENCHMARK(BM_intrusive_sort)->Apply(sizes);
+
+BENCHMARK(BM_restart_push_back)->Apply(sizes);
+BENCHMARK(BM_restart_load)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_restart_load_mapped, s21::list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_restart_load_mapped,
+                   s21::list<int, s21::node_pool_allocator<int>>)
+    ->Apply(sizes);
+
+BENCHMARK(BM_sort_parallel)
+    ->ArgsProduct({{std::min<std::int64_t>(1000000, BENCH_MAX_SIZE)},
+                   {1, 2, 4, 8, 16}})
+    ->ArgNames({"n", "threads"})
+    ->UseRealTime();
+
+// Throughput as the number of threads grows
+BENCHMARK(BM_queue_concurrent)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_queue_locked)->ThreadRange(1, 64)->UseRealTime();
+
+BENCHMARK_MAIN();
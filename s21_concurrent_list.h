@@ -0,0 +1,360 @@
+#ifndef S21_CONCURRENT_LIST_H
+#define S21_CONCURRENT_LIST_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+namespace detail {
+
+// Hazard pointers (Michael, 2004). Every thread owns a record with two slots
+// that announce the nodes it is about to dereference; a retired node is only
+// freed once no slot points at it.
+struct hazard_record {
+  static constexpr std::size_t kSlots = 2;
+  std::atomic<void*> slots[kSlots] = {};
+  std::atomic<bool> active{false};
+  hazard_record* next = nullptr;
+};
+
+struct retired_node {
+  void* ptr;
+  void (*deleter)(void*);
+};
+
+class hazard_domain {
+ public:
+  static constexpr std::size_t kScanThreshold = 128;
+
+  static hazard_domain& global() {
+    static hazard_domain domain;
+    return domain;
+  }
+
+  ~hazard_domain() {
+    for (retired_node& node : orphans_) node.deleter(node.ptr);
+    hazard_record* record = records_.load();
+    while (record) {
+      hazard_record* next = record->next;
+      delete record;
+      record = next;
+    }
+  }
+
+  // Reuses the record of a finished thread or publishes a new one
+  hazard_record* acquire() {
+    for (hazard_record* record = records_.load(); record;
+         record = record->next) {
+      bool idle = false;
+      if (record->active.compare_exchange_strong(idle, true)) return record;
+    }
+    hazard_record* record = new hazard_record();
+    record->active.store(true);
+    hazard_record* head = records_.load();
+    do {
+      record->next = head;
+    } while (!records_.compare_exchange_weak(head, record));
+    return record;
+  }
+
+  // Thread exit: whatever is still protected by others is handed over to the
+  // domain and freed by a later scan.
+  void release(hazard_record* record, std::vector<retired_node>& retired) {
+    for (auto& slot : record->slots) slot.store(nullptr);
+    scan(retired);
+    if (!retired.empty()) {
+      std::lock_guard<std::mutex> lock(orphans_mutex_);
+      orphans_.insert(orphans_.end(), retired.begin(), retired.end());
+      retired.clear();
+    }
+    record->active.store(false);
+  }
+
+  // Frees every retired node that no thread has announced
+  void scan(std::vector<retired_node>& retired) {
+    {
+      std::unique_lock<std::mutex> lock(orphans_mutex_, std::try_to_lock);
+      if (lock.owns_lock() && !orphans_.empty()) {
+        retired.insert(retired.end(), orphans_.begin(), orphans_.end());
+        orphans_.clear();
+      }
+    }
+    std::vector<void*> hazards;
+    for (hazard_record* record = records_.load(); record;
+         record = record->next) {
+      for (auto& slot : record->slots) {
+        if (void* ptr = slot.load()) hazards.push_back(ptr);
+      }
+    }
+    std::sort(hazards.begin(), hazards.end());
+    auto still_hazardous = [&hazards](const retired_node& node) {
+      return std::binary_search(hazards.begin(), hazards.end(), node.ptr);
+    };
+    auto keep = std::partition(retired.begin(), retired.end(), still_hazardous);
+    for (auto it = keep; it != retired.end(); ++it) it->deleter(it->ptr);
+    retired.erase(keep, retired.end());
+  }
+
+ private:
+  hazard_domain() = default;
+
+  std::atomic<hazard_record*> records_{nullptr};
+  std::mutex orphans_mutex_;
+  std::vector<retired_node> orphans_;
+};
+
+struct hazard_thread {
+  hazard_record* record;
+  std::vector<retired_node> retired;
+
+  hazard_thread() : record(hazard_domain::global().acquire()) {}
+  ~hazard_thread() { hazard_domain::global().release(record, retired); }
+
+  static hazard_thread& local() {
+    thread_local hazard_thread state;
+    return state;
+  }
+
+  // Announces the current value of src in slot and returns it once the
+  // announcement is known to have happened before any retire of it
+  template <typename N>
+  N* protect(const std::atomic<N*>& src, std::size_t slot) {
+    N* ptr = src.load();
+    while (true) {
+      record->slots[slot].store(ptr);
+      N* again = src.load();
+      if (again == ptr) return ptr;
+      ptr = again;
+    }
+  }
+
+  void clear() {
+    for (auto& slot : record->slots) slot.store(nullptr);
+  }
+
+  void retire(void* ptr, void (*deleter)(void*)) {
+    retired.push_back({ptr, deleter});
+    if (retired.size() >= hazard_domain::kScanThreshold) {
+      hazard_domain::global().scan(retired);
+    }
+  }
+};
+
+}  // namespace detail
+
+// Lock-free multi-producer multi-consumer list used as a work queue. Built on
+// the Michael-Scott queue: a dummy node at the head, values are linked in by
+// CAS on the next pointer of the tail and taken from the node after the dummy.
+//
+// Each node carries a state so that push_front can link a new value in front
+// of the current dummy with a single CAS on head; the old dummy stays in the
+// chain as an empty node that pops skip. A value is owned by the thread that
+// flips its node from kFull to kTaken, independently of who moves head.
+//
+// pop_back is not provided: a singly linked CAS queue cannot find the
+// predecessor of the tail without a lock.
+//
+// T must be nothrow move constructible. The value is moved out after its
+// node is claimed, when other threads may already have moved head past it;
+// a throwing move could neither hand the value out nor put it back. So a
+// pop either returns the value or finds the list empty.
+template <typename T>
+class concurrent_list {
+  static_assert(std::is_nothrow_move_constructible_v<T>,
+                "concurrent_list pops by a move that must not throw");
+
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+
+  concurrent_list();
+  concurrent_list(std::initializer_list<value_type> const& items);
+  concurrent_list(const concurrent_list&) = delete;
+  concurrent_list& operator=(const concurrent_list&) = delete;
+  ~concurrent_list();
+
+  // Snapshot, may be stale as soon as it returns
+  bool empty();
+
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(value_type&& value) { emplace_back(std::move(value)); }
+  void push_front(const_reference value) { emplace_front(value); }
+  void push_front(value_type&& value) { emplace_front(std::move(value)); }
+  template <class... Args>
+  void emplace_back(Args&&... args);
+  template <class... Args>
+  void emplace_front(Args&&... args);
+
+  std::optional<value_type> try_pop_front();
+  std::optional<value_type> try_pop() { return try_pop_front(); }
+  void pop_front();
+
+ private:
+  enum : int { kEmpty, kFull, kTaken };
+
+  struct Node {
+    std::atomic<Node*> next{nullptr};
+    std::atomic<int> state;
+    alignas(T) unsigned char storage[sizeof(T)];
+
+    explicit Node(int initial) : state(initial) {}
+    T* value() { return std::launder(reinterpret_cast<T*>(storage)); }
+  };
+
+  template <class... Args>
+  static Node* create_node(Args&&... args);
+  static void delete_node(void* node) { delete static_cast<Node*>(node); }
+
+  alignas(64) std::atomic<Node*> head_;
+  alignas(64) std::atomic<Node*> tail_;
+};
+
+template <typename T>
+concurrent_list<T>::concurrent_list() {
+  Node* dummy = new Node(kEmpty);
+  head_.store(dummy);
+  tail_.store(dummy);
+}
+
+template <typename T>
+concurrent_list<T>::concurrent_list(
+    std::initializer_list<value_type> const& items)
+    : concurrent_list() {
+  for (const auto& item : items) push_back(item);
+}
+
+// Not thread safe: no other thread may use the list any more
+template <typename T>
+concurrent_list<T>::~concurrent_list() {
+  Node* node = head_.load();
+  while (node) {
+    Node* next = node->next.load();
+    if (node->state.load() == kFull) node->value()->~T();
+    delete node;
+    node = next;
+  }
+}
+
+// Skips (and unlinks) the empty nodes in front of the first value
+template <typename T>
+bool concurrent_list<T>::empty() {
+  auto& hazards = detail::hazard_thread::local();
+  while (true) {
+    Node* head = hazards.protect(head_, 0);
+    Node* tail = tail_.load();
+    Node* next = head->next.load();
+    hazards.record->slots[1].store(next);
+    if (head != head_.load()) continue;
+    if (next == nullptr || next->state.load() == kFull) {
+      hazards.clear();
+      return next == nullptr;
+    }
+    if (head == tail) {
+      tail_.compare_exchange_strong(tail, next);
+    } else if (head_.compare_exchange_strong(head, next)) {
+      hazards.retire(head, &delete_node);
+    }
+  }
+}
+
+template <typename T>
+template <class... Args>
+void concurrent_list<T>::emplace_back(Args&&... args) {
+  Node* node = create_node(std::forward<Args>(args)...);
+  auto& hazards = detail::hazard_thread::local();
+  while (true) {
+    Node* tail = hazards.protect(tail_, 0);
+    Node* next = tail->next.load();
+    if (tail != tail_.load()) continue;
+    if (next == nullptr) {
+      if (tail->next.compare_exchange_weak(next, node)) {
+        tail_.compare_exchange_strong(tail, node);
+        break;
+      }
+    } else {
+      // Tail is lagging behind, help it forward
+      tail_.compare_exchange_strong(tail, next);
+    }
+  }
+  hazards.clear();
+}
+
+template <typename T>
+template <class... Args>
+void concurrent_list<T>::emplace_front(Args&&... args) {
+  Node* node = create_node(std::forward<Args>(args)...);
+  Node* dummy = new Node(kEmpty);
+  dummy->next.store(node);
+  // head is only stored, never dereferenced, so it needs no hazard
+  Node* head = head_.load();
+  do {
+    node->next.store(head);
+  } while (!head_.compare_exchange_weak(head, dummy));
+}
+
+template <typename T>
+std::optional<typename concurrent_list<T>::value_type>
+concurrent_list<T>::try_pop_front() {
+  auto& hazards = detail::hazard_thread::local();
+  while (true) {
+    Node* head = hazards.protect(head_, 0);
+    Node* tail = tail_.load();
+    Node* next = head->next.load();
+    hazards.record->slots[1].store(next);
+    if (head != head_.load()) continue;
+    if (next == nullptr) {
+      hazards.clear();
+      return std::nullopt;
+    }
+    if (head == tail) {
+      // Head never overtakes tail
+      tail_.compare_exchange_strong(tail, next);
+      continue;
+    }
+    int full = kFull;
+    bool claimed = next->state.compare_exchange_strong(full, kTaken);
+    if (head_.compare_exchange_strong(head, next)) {
+      hazards.retire(head, &delete_node);
+    }
+    if (claimed) {
+      std::optional<value_type> result(std::move(*next->value()));
+      next->value()->~T();
+      hazards.clear();
+      return result;
+    }
+  }
+}
+
+template <typename T>
+void concurrent_list<T>::pop_front() {
+  if (!try_pop_front()) {
+    throw "out_of_range";
+  }
+}
+
+template <typename T>
+template <class... Args>
+typename concurrent_list<T>::Node* concurrent_list<T>::create_node(
+    Args&&... args) {
+  Node* node = new Node(kFull);
+  try {
+    new (node->storage) T(std::forward<Args>(args)...);
+  } catch (...) {
+    delete node;
+    throw;
+  }
+  return node;
+}
+
+}  // namespace s21
+#endif
@@ -0,0 +1,584 @@
+#ifndef S21_INDEXED_LIST_H
+#define S21_INDEXED_LIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "s21_list_hook.h"
+
+namespace s21 {
+
+// Doubly linked list with positional access. The nodes form the usual ring
+// for iteration and, on top of it, an implicit treap: a binary tree ordered
+// by list position, heap-ordered by a random priority and annotated with
+// subtree sizes. at, insert_at, erase_at and index_of walk one root-to-node
+// path, O(log n) expected; iteration still follows the ring links.
+//
+// Splicing a whole list in joins the two trees, O(log n) expected instead of
+// O(1). sort relinks the ring and rebuilds the tree in O(n).
+template <typename T>
+class indexed_list {
+ public:
+  // List Member Type
+  class ListIterator;
+  class ConstListIterator;
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+  using iterator = ListIterator;
+  using const_iterator = ConstListIterator;
+
+ private:
+  struct Node : list_hook {
+    template <class... Args>
+    explicit Node(std::uint32_t p, Args&&... args)
+        : priority(p), value(std::forward<Args>(args)...) {}
+
+    Node* left = nullptr;
+    Node* right = nullptr;
+    Node* parent = nullptr;
+    size_type weight = 1;  // nodes in the subtree rooted here
+    std::uint32_t priority;
+    T value;
+  };
+
+  list_hook sentinel_;
+  Node* root_;
+  std::uint32_t seed_;  // xorshift state for the node priorities
+
+  static Node* node(list_hook* hook) { return static_cast<Node*>(hook); }
+
+ public:
+  class ListIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    list_hook* n_current;
+
+    ListIterator() : n_current(nullptr) {}
+    explicit ListIterator(list_hook* hook) : n_current(hook) {}
+
+    reference operator*() const { return node(n_current)->value; }
+    pointer operator->() const { return &node(n_current)->value; }
+
+    ListIterator& operator++() {
+      n_current = n_current->next;
+      return *this;
+    }
+    ListIterator operator++(int) {
+      ListIterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+    ListIterator& operator--() {
+      n_current = n_current->prev;
+      return *this;
+    }
+    ListIterator operator--(int) {
+      ListIterator tmp = *this;
+      --(*this);
+      return tmp;
+    }
+
+    bool operator==(const ListIterator& other) const {
+      return n_current == other.n_current;
+    }
+    bool operator!=(const ListIterator& other) const {
+      return n_current != other.n_current;
+    }
+  };
+
+  class ConstListIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    list_hook* n_current;
+
+    ConstListIterator() : n_current(nullptr) {}
+    explicit ConstListIterator(list_hook* hook) : n_current(hook) {}
+    ConstListIterator(const ListIterator& it) : n_current(it.n_current) {}
+
+    reference operator*() const { return node(n_current)->value; }
+    pointer operator->() const { return &node(n_current)->value; }
+
+    ConstListIterator& operator++() {
+      n_current = n_current->next;
+      return *this;
+    }
+    ConstListIterator operator++(int) {
+      ConstListIterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+    ConstListIterator& operator--() {
+      n_current = n_current->prev;
+      return *this;
+    }
+    ConstListIterator operator--(int) {
+      ConstListIterator tmp = *this;
+      --(*this);
+      return tmp;
+    }
+
+    // Friends, so that iterator and const_iterator compare either way round
+    friend bool operator==(const ConstListIterator& a,
+                           const ConstListIterator& b) {
+      return a.n_current == b.n_current;
+    }
+    friend bool operator!=(const ConstListIterator& a,
+                           const ConstListIterator& b) {
+      return a.n_current != b.n_current;
+    }
+  };
+
+  // iterator
+  iterator begin() { return iterator(sentinel_.next); }
+  iterator end() { return iterator(&sentinel_); }
+  const_iterator begin() const { return const_iterator(sentinel_.next); }
+  const_iterator end() const {
+    return const_iterator(const_cast<list_hook*>(&sentinel_));
+  }
+
+  // List Functions
+  indexed_list();
+  explicit indexed_list(size_type n);
+  indexed_list(std::initializer_list<value_type> const& items);
+  indexed_list(const indexed_list& l);
+  indexed_list(indexed_list&& l);
+  ~indexed_list() { clear(); }
+
+  // Operators
+  indexed_list& operator=(indexed_list&& l);
+  indexed_list& operator=(const indexed_list& l);
+
+  // List Element access
+  const_reference front();
+  const_reference back();
+  // Positional access, O(log n) expected; throws out_of_range past the end
+  reference at(size_type index);
+  const_reference at(size_type index) const;
+  reference operator[](size_type index) { return at(index); }
+  const_reference operator[](size_type index) const { return at(index); }
+  // Position of pos in the list, size() for end()
+  size_type index_of(const_iterator pos) const;
+
+  // Capacity
+  bool empty() const { return !root_; }
+  size_type size() const { return root_ ? root_->weight : 0; }
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(Node) / 2;
+  }
+
+  // Modifiers
+  void clear();
+  iterator insert(const_iterator pos, const_reference value);
+  iterator insert(const_iterator pos, value_type&& value);
+  iterator insert_at(size_type index, const_reference value);
+  iterator insert_at(size_type index, value_type&& value);
+  iterator erase(const_iterator pos);  // returns the element after pos
+  void erase_at(size_type index);
+  void push_back(const_reference value) { insert_at(size(), value); }
+  void push_back(value_type&& value) { insert_at(size(), std::move(value)); }
+  void pop_back();
+  void push_front(const_reference value) { insert_at(0, value); }
+  void push_front(value_type&& value) { insert_at(0, std::move(value)); }
+  void pop_front();
+  void swap(indexed_list& other);
+  void splice(const_iterator pos, indexed_list& other);
+  void sort() { sort(std::less<value_type>()); }
+  template <typename Compare>
+  void sort(Compare comp);  // stable
+
+  template <class... Args>
+  iterator emplace_at(size_type index, Args&&... args);
+
+ private:
+  static size_type weight(const Node* t) { return t ? t->weight : 0; }
+  static void update(Node* t);
+  static Node* join(Node* left, Node* right);
+  static void split(Node* t, size_type index, Node*& left, Node*& right);
+
+  Node* node_at(size_type index) const;
+  std::uint32_t next_priority();
+  void rebuild();
+  void adopt_sentinel();
+};
+
+template <typename T>
+indexed_list<T>::indexed_list()
+    : sentinel_{&sentinel_, &sentinel_}, root_(nullptr), seed_(0x2545F491) {}
+
+template <typename T>
+indexed_list<T>::indexed_list(size_type n) : indexed_list() {
+  for (size_type i = 0; i < n; i++) {
+    emplace_at(i);
+  }
+}
+
+template <typename T>
+indexed_list<T>::indexed_list(std::initializer_list<value_type> const& items)
+    : indexed_list() {
+  for (const auto& item : items) {
+    push_back(item);
+  }
+}
+
+template <typename T>
+indexed_list<T>::indexed_list(const indexed_list& l) : indexed_list() {
+  *this = l;
+}
+
+template <typename T>
+indexed_list<T>::indexed_list(indexed_list&& l) : indexed_list() {
+  swap(l);
+}
+
+template <typename T>
+indexed_list<T>& indexed_list<T>::operator=(indexed_list&& other) {
+  if (this == &other) return *this;
+  clear();
+  swap(other);
+  return *this;
+}
+
+// Appends to the ring only and builds the tree once at the end, O(n)
+template <typename T>
+indexed_list<T>& indexed_list<T>::operator=(const indexed_list& other) {
+  if (this == &other) return *this;
+  clear();
+  try {
+    for (const auto& item : other) {
+      Node* created = new Node(next_priority(), item);
+      detail::link_range(&sentinel_, created, created);
+    }
+  } catch (...) {
+    clear();
+    throw;
+  }
+  rebuild();
+  return *this;
+}
+
+template <typename T>
+typename indexed_list<T>::const_reference indexed_list<T>::front() {
+  if (empty()) {
+    throw "out_of_range";
+  }
+  return node(sentinel_.next)->value;
+}
+
+template <typename T>
+typename indexed_list<T>::const_reference indexed_list<T>::back() {
+  if (empty()) {
+    throw "out_of_range";
+  }
+  return node(sentinel_.prev)->value;
+}
+
+template <typename T>
+typename indexed_list<T>::reference indexed_list<T>::at(size_type index) {
+  return node_at(index)->value;
+}
+
+template <typename T>
+typename indexed_list<T>::const_reference indexed_list<T>::at(
+    size_type index) const {
+  return node_at(index)->value;
+}
+
+// Every right turn on the way up passes a left subtree and its root
+template <typename T>
+typename indexed_list<T>::size_type indexed_list<T>::index_of(
+    const_iterator pos) const {
+  if (pos.n_current == &sentinel_) return size();
+  const Node* current = node(pos.n_current);
+  size_type index = weight(current->left);
+  for (; current->parent; current = current->parent) {
+    if (current->parent->right == current) {
+      index += weight(current->parent->left) + 1;
+    }
+  }
+  return index;
+}
+
+template <typename T>
+void indexed_list<T>::clear() {
+  list_hook* current = sentinel_.next;
+  while (current != &sentinel_) {
+    list_hook* next = current->next;
+    delete node(current);
+    current = next;
+  }
+  sentinel_.next = sentinel_.prev = &sentinel_;
+  root_ = nullptr;
+}
+
+template <typename T>
+typename indexed_list<T>::iterator indexed_list<T>::insert(
+    const_iterator pos, const_reference value) {
+  return emplace_at(index_of(pos), value);
+}
+
+template <typename T>
+typename indexed_list<T>::iterator indexed_list<T>::insert(
+    const_iterator pos, value_type&& value) {
+  return emplace_at(index_of(pos), std::move(value));
+}
+
+template <typename T>
+typename indexed_list<T>::iterator indexed_list<T>::insert_at(
+    size_type index, const_reference value) {
+  return emplace_at(index, value);
+}
+
+template <typename T>
+typename indexed_list<T>::iterator indexed_list<T>::insert_at(
+    size_type index, value_type&& value) {
+  return emplace_at(index, std::move(value));
+}
+
+// Descends by position until the new node's priority wins, then splits the
+// subtree there into its two children
+template <typename T>
+template <class... Args>
+typename indexed_list<T>::iterator indexed_list<T>::emplace_at(
+    size_type index, Args&&... args) {
+  if (index > size()) {
+    throw "out_of_range";
+  }
+  list_hook* pos = index == size() ? &sentinel_ : node_at(index);
+  Node* created = new Node(next_priority(), std::forward<Args>(args)...);
+  detail::link_range(pos, created, created);
+
+  Node** link = &root_;
+  Node* parent = nullptr;
+  while (*link && (*link)->priority > created->priority) {
+    parent = *link;
+    parent->weight++;
+    size_type left = weight(parent->left);
+    if (index <= left) {
+      link = &parent->left;
+    } else {
+      index -= left + 1;
+      link = &parent->right;
+    }
+  }
+  split(*link, index, created->left, created->right);
+  update(created);
+  created->parent = parent;
+  *link = created;
+  return iterator(created);
+}
+
+// The children of pos take its place; the sizes above it shrink by one
+template <typename T>
+typename indexed_list<T>::iterator indexed_list<T>::erase(
+    const_iterator pos) {
+  if (pos.n_current == &sentinel_) {
+    throw "out_of_range";
+  }
+  Node* target = node(pos.n_current);
+  list_hook* next = target->next;
+  detail::unlink_range(target, target);
+
+  Node* parent = target->parent;
+  Node* replacement = join(target->left, target->right);
+  if (replacement) replacement->parent = parent;
+  if (!parent) {
+    root_ = replacement;
+  } else if (parent->left == target) {
+    parent->left = replacement;
+  } else {
+    parent->right = replacement;
+  }
+  for (; parent; parent = parent->parent) parent->weight--;
+  delete target;
+  return iterator(next);
+}
+
+template <typename T>
+void indexed_list<T>::erase_at(size_type index) {
+  erase(const_iterator(node_at(index)));
+}
+
+template <typename T>
+void indexed_list<T>::pop_back() {
+  if (empty()) {
+    throw "out_of_range";
+  }
+  erase(const_iterator(sentinel_.prev));
+}
+
+template <typename T>
+void indexed_list<T>::pop_front() {
+  if (empty()) {
+    throw "out_of_range";
+  }
+  erase(const_iterator(sentinel_.next));
+}
+
+template <typename T>
+void indexed_list<T>::swap(indexed_list& other) {
+  std::swap(sentinel_, other.sentinel_);
+  std::swap(root_, other.root_);
+  std::swap(seed_, other.seed_);
+  adopt_sentinel();
+  other.adopt_sentinel();
+}
+
+// Moves every node of other before pos: one link in the ring, one split and
+// two joins in the tree
+template <typename T>
+void indexed_list<T>::splice(const_iterator pos, indexed_list& other) {
+  if (&other == this || other.empty()) return;
+  Node* left = nullptr;
+  Node* right = nullptr;
+  split(root_, index_of(pos), left, right);
+  root_ = join(join(left, other.root_), right);
+  root_->parent = nullptr;
+
+  list_hook* first = other.sentinel_.next;
+  list_hook* last = other.sentinel_.prev;
+  detail::unlink_range(first, last);
+  detail::link_range(pos.n_current, first, last);
+  other.root_ = nullptr;
+}
+
+// Sorting only reorders the ring, the tree is then rebuilt in list order
+template <typename T>
+template <typename Compare>
+void indexed_list<T>::sort(Compare comp) {
+  auto less = [&comp](list_hook* a, list_hook* b) {
+    return comp(node(a)->value, node(b)->value);
+  };
+  detail::sort_ring(&sentinel_, less);
+  rebuild();
+}
+
+template <typename T>
+void indexed_list<T>::update(Node* t) {
+  t->weight = 1 + weight(t->left) + weight(t->right);
+  if (t->left) t->left->parent = t;
+  if (t->right) t->right->parent = t;
+}
+
+// Concatenates two trees, every node of left coming first
+template <typename T>
+typename indexed_list<T>::Node* indexed_list<T>::join(Node* left,
+                                                      Node* right) {
+  if (!left) return right;
+  if (!right) return left;
+  if (left->priority > right->priority) {
+    left->right = join(left->right, right);
+    update(left);
+    return left;
+  }
+  right->left = join(left, right->left);
+  update(right);
+  return right;
+}
+
+// Cuts t into its first index nodes and the rest
+template <typename T>
+void indexed_list<T>::split(Node* t, size_type index, Node*& left,
+                            Node*& right) {
+  if (!t) {
+    left = right = nullptr;
+    return;
+  }
+  if (index <= weight(t->left)) {
+    split(t->left, index, left, t->left);
+    update(t);
+    right = t;
+  } else {
+    split(t->right, index - weight(t->left) - 1, t->right, right);
+    update(t);
+    left = t;
+  }
+}
+
+template <typename T>
+typename indexed_list<T>::Node* indexed_list<T>::node_at(
+    size_type index) const {
+  if (index >= size()) {
+    throw "out_of_range";
+  }
+  Node* current = root_;
+  for (;;) {
+    size_type left = weight(current->left);
+    if (index == left) return current;
+    if (index < left) {
+      current = current->left;
+    } else {
+      index -= left + 1;
+      current = current->right;
+    }
+  }
+}
+
+template <typename T>
+std::uint32_t indexed_list<T>::next_priority() {
+  seed_ ^= seed_ << 13;
+  seed_ ^= seed_ >> 17;
+  seed_ ^= seed_ << 5;
+  return seed_;
+}
+
+// Builds the tree of the ring in list order with the usual stack algorithm
+// for Cartesian trees: the stack holds the right spine, a node is final when
+// it is popped.
+template <typename T>
+void indexed_list<T>::rebuild() {
+  std::vector<Node*> spine;
+  for (list_hook* hook = sentinel_.next; hook != &sentinel_;
+       hook = hook->next) {
+    Node* current = node(hook);
+    Node* last = nullptr;
+    while (!spine.empty() && spine.back()->priority < current->priority) {
+      last = spine.back();
+      spine.pop_back();
+      update(last);
+    }
+    current->left = last;
+    current->right = nullptr;
+    if (!spine.empty()) spine.back()->right = current;
+    spine.push_back(current);
+  }
+  while (spine.size() > 1) {
+    update(spine.back());
+    spine.pop_back();
+  }
+  root_ = spine.empty() ? nullptr : spine.front();
+  if (root_) {
+    update(root_);
+    root_->parent = nullptr;
+  }
+}
+
+// Points the end hooks back at this sentinel after it was swapped
+template <typename T>
+void indexed_list<T>::adopt_sentinel() {
+  if (!root_) {
+    sentinel_.next = sentinel_.prev = &sentinel_;
+  } else {
+    sentinel_.next->prev = sentinel_.prev->next = &sentinel_;
+  }
+}
+
+}  // namespace s21
+#endif
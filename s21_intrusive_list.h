@@ -0,0 +1,407 @@
+#ifndef S21_INTRUSIVE_LIST_H
+#define S21_INTRUSIVE_LIST_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+#include "s21_list_hook.h"
+
+namespace s21 {
+
+// Doubly linked list of caller-owned objects, linked through the list_hook
+// member Hook of T:
+//
+//   struct timer {
+//     s21::list_hook hook;
+//     int deadline;
+//   };
+//   s21::intrusive_list<timer, &timer::hook> timers;
+//
+// Nothing is allocated or copied. The list never owns its elements: an
+// element must outlive its membership, belongs to at most one list per hook
+// and is only unlinked (never destroyed) by erase, pop and clear.
+template <typename T, list_hook T::*Hook>
+class intrusive_list {
+ public:
+  // List Member Type
+  class ListIterator;
+  class ConstListIterator;
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+  using iterator = ListIterator;
+  using const_iterator = ConstListIterator;
+
+ private:
+  list_hook sentinel_;
+  size_type list_size;
+
+  // Offset of the hook inside T, the same in every T. insert reads it off
+  // the element it links, so it is known before owner() sees any hook. Lists
+  // on other threads can only store that same value, hence relaxed.
+  static inline std::atomic<std::ptrdiff_t> hook_offset_{-1};
+
+  static T* owner(list_hook* hook) {
+    return reinterpret_cast<T*>(
+        reinterpret_cast<char*>(hook) -
+        hook_offset_.load(std::memory_order_relaxed));
+  }
+  static list_hook* hook_of(T& item) { return &(item.*Hook); }
+  static void record_offset(T& item) {
+    if (hook_offset_.load(std::memory_order_relaxed) < 0) {
+      hook_offset_.store(reinterpret_cast<char*>(hook_of(item)) -
+                             reinterpret_cast<char*>(&item),
+                         std::memory_order_relaxed);
+    }
+  }
+
+ public:
+  class ListIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    list_hook* n_current;
+
+    ListIterator() : n_current(nullptr) {}
+    explicit ListIterator(list_hook* hook) : n_current(hook) {}
+
+    reference operator*() const { return *owner(n_current); }
+    pointer operator->() const { return owner(n_current); }
+
+    ListIterator& operator++() {
+      n_current = n_current->next;
+      return *this;
+    }
+    ListIterator operator++(int) {
+      ListIterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+    ListIterator& operator--() {
+      n_current = n_current->prev;
+      return *this;
+    }
+    ListIterator operator--(int) {
+      ListIterator tmp = *this;
+      --(*this);
+      return tmp;
+    }
+
+    bool operator==(const ListIterator& other) const {
+      return n_current == other.n_current;
+    }
+    bool operator!=(const ListIterator& other) const {
+      return n_current != other.n_current;
+    }
+  };
+
+  class ConstListIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    list_hook* n_current;
+
+    ConstListIterator() : n_current(nullptr) {}
+    explicit ConstListIterator(list_hook* hook) : n_current(hook) {}
+    ConstListIterator(const ListIterator& it) : n_current(it.n_current) {}
+
+    reference operator*() const { return *owner(n_current); }
+    pointer operator->() const { return owner(n_current); }
+
+    ConstListIterator& operator++() {
+      n_current = n_current->next;
+      return *this;
+    }
+    ConstListIterator operator++(int) {
+      ConstListIterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+    ConstListIterator& operator--() {
+      n_current = n_current->prev;
+      return *this;
+    }
+    ConstListIterator operator--(int) {
+      ConstListIterator tmp = *this;
+      --(*this);
+      return tmp;
+    }
+
+    // Friends, so that iterator and const_iterator compare either way round
+    friend bool operator==(const ConstListIterator& a,
+                           const ConstListIterator& b) {
+      return a.n_current == b.n_current;
+    }
+    friend bool operator!=(const ConstListIterator& a,
+                           const ConstListIterator& b) {
+      return a.n_current != b.n_current;
+    }
+  };
+
+  // iterator
+  iterator begin() { return iterator(sentinel_.next); }
+  iterator end() { return iterator(&sentinel_); }
+  const_iterator begin() const { return const_iterator(sentinel_.next); }
+  const_iterator end() const {
+    return const_iterator(const_cast<list_hook*>(&sentinel_));
+  }
+  // Iterator to an element known to be in this list, O(1)
+  iterator iterator_to(reference item) { return iterator(hook_of(item)); }
+
+  // List Functions
+  intrusive_list() : sentinel_{&sentinel_, &sentinel_}, list_size(0) {}
+  intrusive_list(const intrusive_list&) = delete;
+  intrusive_list(intrusive_list&& other);
+  ~intrusive_list() { clear(); }
+
+  intrusive_list& operator=(const intrusive_list&) = delete;
+  intrusive_list& operator=(intrusive_list&& other);
+
+  // List Element access
+  reference front();
+  reference back();
+
+  // Capacity
+  bool empty() const { return !list_size; }
+  size_type size() const { return list_size; }
+
+  // An element is linked while its hook is in some list
+  static bool is_linked(const_reference item) {
+    return (item.*Hook).next != nullptr;
+  }
+
+  // Modifiers
+  void clear();
+  iterator insert(const_iterator pos, reference item);
+  iterator erase(const_iterator pos);
+  void erase(reference item);
+  void push_back(reference item) { insert(end(), item); }
+  void push_front(reference item) { insert(begin(), item); }
+  void pop_back();
+  void pop_front();
+  void swap(intrusive_list& other);
+  void merge(intrusive_list& other) { merge(other, std::less<T>()); }
+  template <typename Compare>
+  void merge(intrusive_list& other, Compare comp);
+  void splice(const_iterator pos, intrusive_list& other);
+  void splice(const_iterator pos, intrusive_list& other, const_iterator it);
+  void splice(const_iterator pos, intrusive_list& other,
+              const_iterator first, const_iterator last);
+  void reverse() { detail::reverse_ring(&sentinel_); }
+  void unique();  // unlinks consecutive duplicates
+  void sort() { sort(std::less<T>()); }
+  template <typename Compare>
+  void sort(Compare comp);  // stable
+
+ private:
+  template <typename Compare>
+  static auto by_value(Compare& comp) {
+    return [&comp](list_hook* a, list_hook* b) {
+      return comp(*owner(a), *owner(b));
+    };
+  }
+
+  void adopt_sentinel();
+  static void unhook(list_hook* hook) { hook->next = hook->prev = nullptr; }
+};
+
+template <typename T, list_hook T::*Hook>
+intrusive_list<T, Hook>::intrusive_list(intrusive_list&& other)
+    : intrusive_list() {
+  swap(other);
+}
+
+template <typename T, list_hook T::*Hook>
+intrusive_list<T, Hook>& intrusive_list<T, Hook>::operator=(
+    intrusive_list&& other) {
+  if (this == &other) return *this;
+  clear();
+  swap(other);
+  return *this;
+}
+
+template <typename T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::reference intrusive_list<T, Hook>::front() {
+  if (list_size == 0) {
+    throw "out_of_range";
+  }
+  return *owner(sentinel_.next);
+}
+
+template <typename T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::reference intrusive_list<T, Hook>::back() {
+  if (list_size == 0) {
+    throw "out_of_range";
+  }
+  return *owner(sentinel_.prev);
+}
+
+// Unlinks every element, O(n) because each hook is reset
+template <typename T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::clear() {
+  list_hook* current = sentinel_.next;
+  while (current != &sentinel_) {
+    list_hook* next = current->next;
+    unhook(current);
+    current = next;
+  }
+  sentinel_.next = sentinel_.prev = &sentinel_;
+  list_size = 0;
+}
+
+template <typename T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::insert(
+    const_iterator pos, reference item) {
+  list_hook* hook = hook_of(item);
+  if (hook->next) {
+    throw "already_linked";
+  }
+  record_offset(item);
+  detail::link_range(pos.n_current, hook, hook);
+  list_size++;
+  return iterator(hook);
+}
+
+template <typename T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::erase(
+    const_iterator pos) {
+  list_hook* hook = pos.n_current;
+  if (hook == &sentinel_) {
+    throw "out_of_range";
+  }
+  list_hook* next = hook->next;
+  detail::unlink_range(hook, hook);
+  unhook(hook);
+  list_size--;
+  return iterator(next);
+}
+
+template <typename T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::erase(reference item) {
+  erase(const_iterator(hook_of(item)));
+}
+
+template <typename T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::pop_back() {
+  if (list_size == 0) {
+    throw "out_of_range";
+  }
+  erase(const_iterator(sentinel_.prev));
+}
+
+template <typename T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::pop_front() {
+  if (list_size == 0) {
+    throw "out_of_range";
+  }
+  erase(const_iterator(sentinel_.next));
+}
+
+template <typename T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::swap(intrusive_list& other) {
+  std::swap(sentinel_, other.sentinel_);
+  std::swap(list_size, other.list_size);
+  adopt_sentinel();
+  other.adopt_sentinel();
+}
+
+// On equal keys the elements of *this come first
+template <typename T, list_hook T::*Hook>
+template <typename Compare>
+void intrusive_list<T, Hook>::merge(intrusive_list& other, Compare comp) {
+  auto less = by_value(comp);
+  detail::merge_rings(&sentinel_, list_size, &other.sentinel_,
+                      other.list_size, less);
+}
+
+template <typename T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos,
+                                     intrusive_list& other) {
+  if (&other == this || other.empty()) return;
+  list_hook* first = other.sentinel_.next;
+  list_hook* last = other.sentinel_.prev;
+  detail::unlink_range(first, last);
+  detail::link_range(pos.n_current, first, last);
+  list_size += other.list_size;
+  other.list_size = 0;
+}
+
+template <typename T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos,
+                                     intrusive_list& other,
+                                     const_iterator it) {
+  list_hook* hook = it.n_current;
+  if (pos.n_current == hook || pos.n_current == hook->next) return;
+  detail::unlink_range(hook, hook);
+  detail::link_range(pos.n_current, hook, hook);
+  other.list_size--;
+  list_size++;
+}
+
+// O(1) within one list, otherwise O(1) plus counting the moved range
+template <typename T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos,
+                                     intrusive_list& other,
+                                     const_iterator first,
+                                     const_iterator last) {
+  list_hook* begin = first.n_current;
+  list_hook* end = last.n_current;
+  if (begin == end || pos.n_current == end) return;
+  if (&other != this) {
+    size_type count = 0;
+    for (list_hook* it = begin; it != end; it = it->next) count++;
+    other.list_size -= count;
+    list_size += count;
+  }
+  list_hook* back = end->prev;
+  detail::unlink_range(begin, back);
+  detail::link_range(pos.n_current, begin, back);
+}
+
+template <typename T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::unique() {
+  if (list_size < 2) return;
+  list_hook* current = sentinel_.next;
+  while (current->next != &sentinel_) {
+    list_hook* next = current->next;
+    if (*owner(current) == *owner(next)) {
+      detail::unlink_range(next, next);
+      unhook(next);
+      list_size--;
+    } else {
+      current = next;
+    }
+  }
+}
+
+template <typename T, list_hook T::*Hook>
+template <typename Compare>
+void intrusive_list<T, Hook>::sort(Compare comp) {
+  auto less = by_value(comp);
+  detail::sort_ring(&sentinel_, less);
+}
+
+// Points the end hooks back at this sentinel after it was swapped
+template <typename T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::adopt_sentinel() {
+  if (list_size == 0) {
+    sentinel_.next = sentinel_.prev = &sentinel_;
+  } else {
+    sentinel_.next->prev = sentinel_.prev->next = &sentinel_;
+  }
+}
+
+}  // namespace s21
+#endif
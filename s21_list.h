@@ -1,48 +1,240 @@
 #ifndef S21_LIST_H
 #define S21_LIST_H
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include "s21_list_hook.h"
+#include "s21_list_io.h"
+#include "s21_list_simd.h"
+#include "s21_list_stats.h"
+#include "s21_node_pool.h"
+
+// Nodes the traversal helpers (for_each, accumulate, find_if,
+// for_each_batch) prefetch ahead. A fragmented list is one chain of
+// dependent loads that prefetching cannot shorten, and measured it only
+// added work, so it is off unless a build asks for it.
+#ifndef S21_LIST_PREFETCH_DISTANCE
+#define S21_LIST_PREFETCH_DISTANCE 0
+#endif
 
 namespace s21 {
+namespace detail {
+// Allocators may offer exclusive()/release_all() to drop every node at once;
+// clear() uses it when destroying the values is a no-op.
+template <typename A, typename = void>
+struct has_bulk_release : std::false_type {};
+template <typename A>
+struct has_bulk_release<
+    A, std::void_t<decltype(std::declval<const A&>().exclusive()),
+                   decltype(std::declval<A&>().release_all())>>
+    : std::true_type {};
+
+// Allocators may also report when their nodes have scattered enough for
+// compact_if_needed() to compact (see node_pool_allocator::set_compact_ratio)
+template <typename A, typename = void>
+struct has_compact_hint : std::false_type {};
+template <typename A>
+struct has_compact_hint<
+    A, std::void_t<decltype(std::declval<const A&>().wants_compact(0)),
+                   decltype(std::declval<A&>().compacted())>>
+    : std::true_type {};
+
+// ... and reserve(n) to serve the next n nodes from one contiguous block
+template <typename A, typename = void>
+struct has_reserve : std::false_type {};
+template <typename A>
+struct has_reserve<A, std::void_t<decltype(std::declval<A&>().reserve(0))>>
+    : std::true_type {};
+
+// Keeps the iterator-pair overloads away from calls like insert(pos, 3, 7)
+template <typename It>
+using require_input_iterator = std::enable_if_t<std::is_convertible_v<
+    typename std::iterator_traits<It>::iterator_category,
+    std::input_iterator_tag>>;
+
+// begin()/end() pair for range-for over something other than the container
+template <typename It>
+struct iterator_range {
+  It first;
+  It last;
+
+  It begin() const { return first; }
+  It end() const { return last; }
+};
+
+// uzel
 template <typename T>
-class list {
+struct list_node : list_hook {
+  T data;
+  template <class... Args>
+  explicit list_node(Args&&... args)
+      : list_hook{nullptr, nullptr}, data(std::forward<Args>(args)...) {}
+};
+
+template <typename T, typename Allocator>
+using list_node_allocator = typename std::allocator_traits<
+    Allocator>::template rebind_alloc<list_node<T>>;
+
+// Holds the node allocator of a list. One that is empty and not final is an
+// empty base, so the default std::allocator takes no space in the list.
+template <typename A, bool = std::is_empty_v<A> && !std::is_final_v<A>>
+class allocator_holder {
+ public:
+  explicit allocator_holder(const A& alloc) : alloc_(alloc) {}
+  A& node_alloc() noexcept { return alloc_; }
+  const A& node_alloc() const noexcept { return alloc_; }
+
+ private:
+  A alloc_;
+};
+template <typename A>
+class allocator_holder<A, true> : private A {
+ public:
+  explicit allocator_holder(const A& alloc) : A(alloc) {}
+  A& node_alloc() noexcept { return *this; }
+  const A& node_alloc() const noexcept { return *this; }
+};
+
+// Whether giving memory back to alloc does nothing, as with a
+// std::pmr::monotonic_buffer_resource that only frees when it is destroyed.
+// The type must match exactly: a subclass may override do_deallocate.
+template <typename A>
+bool deallocate_is_noop(const A&) {
+  return false;
+}
+template <typename U>
+bool deallocate_is_noop(const std::pmr::polymorphic_allocator<U>& alloc) {
+  return typeid(*alloc.resource()) ==
+         typeid(std::pmr::monotonic_buffer_resource);
+}
+
+// Hints that the Bytes bytes at address will be read soon, one prefetch per
+// cache line
+template <std::size_t Bytes>
+inline void prefetch(const void* address) {
+#if defined(__GNUC__)
+  for (std::size_t offset = 0; offset < Bytes; offset += 64) {
+    __builtin_prefetch(static_cast<const char*>(address) + offset);
+  }
+#else
+  (void)address;
+#endif
+}
+
+// Runs task(0) .. task(n - 1), each on its own thread, and rethrows the first
+// exception once all of them are done. Falls back to the calling thread when
+// no more threads can be started.
+template <typename Task>
+void parallel_for(std::size_t n, Task task) {
+  std::vector<std::exception_ptr> errors(n);
+  auto run = [&task, &errors](std::size_t i) {
+    try {
+      task(i);
+    } catch (...) {
+      errors[i] = std::current_exception();
+    }
+  };
+  std::vector<std::thread> workers;
+  workers.reserve(n);
+  for (std::size_t i = 1; i < n; i++) {
+    try {
+      workers.emplace_back(run, i);
+    } catch (const std::system_error&) {
+      run(i);
+    }
+  }
+  if (n) run(0);
+  for (std::thread& worker : workers) worker.join();
+  for (std::exception_ptr& error : errors) {
+    if (error) std::rethrow_exception(error);
+  }
+}
+}  // namespace detail
+
+namespace execution {
+// Selects the parallel overloads. threads == 0 uses every hardware thread.
+struct parallel_policy {
+  unsigned threads = 0;
+  constexpr parallel_policy with_threads(unsigned n) const { return {n}; }
+};
+inline constexpr parallel_policy par{};
+}  // namespace execution
+
+template <typename T, typename Allocator = std::allocator<T>,
+          typename Stats = no_stats>
+class list : private Stats,
+             private detail::allocator_holder<
+                 detail::list_node_allocator<T, Allocator>> {
  public:
   // List Member Type
   class ListIterator;
   class ConstListIterator;
+  class NodeHandle;
   using value_type = T;
+  using allocator_type = Allocator;
   using reference = T&;
   using const_reference = const T&;
   using size_type = size_t;
   using iterator = ListIterator;
-  using const_iterator = const ListIterator;
+  using const_iterator = ConstListIterator;
+  using node_type = NodeHandle;
 
  private:
-  // uzel
-  struct Node {
-    value_type data;
-    Node* next;
-    Node* prev;
-    Node(const_reference value) : data(value), next(nullptr), prev(nullptr) {}
-  };
-
-  Node* head;
-  Node* tail;
+  // Links only. The list keeps one of these inline as a circular sentinel:
+  // sentinel_.next is the head, sentinel_.prev the tail, &sentinel_ is end().
+  using NodeBase = list_hook;
+
+  using Node = detail::list_node<T>;
+  using node_allocator = detail::list_node_allocator<T, Allocator>;
+  using node_traits = std::allocator_traits<node_allocator>;
+  // The node allocator is an empty base when it can be, like Stats
+  using alloc_holder = detail::allocator_holder<node_allocator>;
+  using alloc_holder::node_alloc;
+
+  NodeBase sentinel_;
   size_type list_size;
 
+  static value_type& value(NodeBase* node) {
+    return static_cast<Node*>(node)->data;
+  }
+
  public:
   class ListIterator {
    public:
-    Node* n_current;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    NodeBase* n_current;
 
     // Constructors & destructor
     ListIterator() : n_current(nullptr) {}
-    explicit ListIterator(Node* node) : n_current(node) {}
+    explicit ListIterator(NodeBase* node) : n_current(node) {}
 
     // overload operators
-    reference operator*() { return n_current->data; }
-    Node* operator->() { return n_current; }
+    reference operator*() const { return value(n_current); }
+    value_type* operator->() const { return &value(n_current); }
 
     ListIterator& operator++() {
       n_current = n_current->next;
@@ -72,22 +264,149 @@ class list {
     }
   };
 
-  class ConstListIterator : public ListIterator {
+  // Converts from iterator, not back; reading through it yields const T&
+  class ConstListIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    NodeBase* n_current;
+
+    ConstListIterator() : n_current(nullptr) {}
+    explicit ConstListIterator(NodeBase* node) : n_current(node) {}
+    ConstListIterator(const ListIterator& it) : n_current(it.n_current) {}
+
+    reference operator*() const { return value(n_current); }
+    pointer operator->() const { return &value(n_current); }
+
+    ConstListIterator& operator++() {
+      n_current = n_current->next;
+      return *this;
+    }
+    ConstListIterator operator++(int) {
+      ConstListIterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+
+    ConstListIterator& operator--() {
+      n_current = n_current->prev;
+      return *this;
+    }
+    ConstListIterator operator--(int) {
+      ConstListIterator tmp = *this;
+      --(*this);
+      return tmp;
+    }
+
+    // Friends, so that iterator and const_iterator compare either way round
+    friend bool operator==(const ConstListIterator& a,
+                           const ConstListIterator& b) {
+      return a.n_current == b.n_current;
+    }
+    friend bool operator!=(const ConstListIterator& a,
+                           const ConstListIterator& b) {
+      return a.n_current != b.n_current;
+    }
+  };
+
+  // Owns one node taken out of a list by extract(), together with a copy of
+  // the allocator that made it; destroys the node if it is never inserted
+  class NodeHandle {
    public:
-    ConstListIterator() : ListIterator() {}
-    explicit ConstListIterator(Node* node) : ListIterator(node) {}
-    const_reference operator*() const { return this->n_current->data; }
+    using value_type = T;
+    using allocator_type = Allocator;
+
+    NodeHandle() = default;
+    NodeHandle(NodeHandle&& other) noexcept
+        : node_(std::exchange(other.node_, nullptr)),
+          alloc_(std::move(other.alloc_)) {
+      other.alloc_.reset();
+    }
+    // Allocators such as std::pmr::polymorphic_allocator cannot be
+    // assigned, so the stored one is always rebuilt
+    NodeHandle& operator=(NodeHandle&& other) noexcept {
+      if (this != &other) {
+        reset();
+        node_ = std::exchange(other.node_, nullptr);
+        if (other.alloc_) alloc_.emplace(std::move(*other.alloc_));
+        other.alloc_.reset();
+      }
+      return *this;
+    }
+    ~NodeHandle() { reset(); }
+
+    bool empty() const noexcept { return node_ == nullptr; }
+    explicit operator bool() const noexcept { return node_ != nullptr; }
+    value_type& value() const { return node_->data; }
+    allocator_type get_allocator() const { return allocator_type(*alloc_); }
+
+    void swap(NodeHandle& other) noexcept {
+      NodeHandle tmp(std::move(other));
+      other = std::move(*this);
+      *this = std::move(tmp);
+    }
+
+   private:
+    friend class list;
+
+    NodeHandle(Node* node, const node_allocator& alloc)
+        : node_(node), alloc_(alloc) {}
+
+    Node* release() noexcept {
+      alloc_.reset();
+      return std::exchange(node_, nullptr);
+    }
+    void reset() noexcept {
+      if (!node_) return;
+      node_traits::destroy(*alloc_, node_);
+      node_traits::deallocate(*alloc_, node_, 1);
+      node_ = nullptr;
+      alloc_.reset();
+    }
+
+    Node* node_ = nullptr;
+    std::optional<node_allocator> alloc_;
   };
 
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
   // iterator
-  iterator begin() { return iterator(head); }
-  iterator end() { return iterator(tail); }
-  const_iterator begin() const { return const_iterator(head); }
-  const_iterator end() const { return const_iterator(tail); }
+  iterator begin() { return iterator(sentinel_.next); }
+  iterator end() { return iterator(&sentinel_); }
+  const_iterator begin() const { return const_iterator(sentinel_.next); }
+  const_iterator end() const {
+    return const_iterator(const_cast<NodeBase*>(&sentinel_));
+  }
+  reverse_iterator rbegin() { return reverse_iterator(end()); }
+  reverse_iterator rend() { return reverse_iterator(begin()); }
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(end());
+  }
+  const_reverse_iterator rend() const {
+    return const_reverse_iterator(begin());
+  }
+  // The elements back to front, without touching the links: an O(1)
+  // alternative to reverse() for a list that is only read backwards
+  detail::iterator_range<reverse_iterator> reversed() {
+    return {rbegin(), rend()};
+  }
+  detail::iterator_range<const_reverse_iterator> reversed() const {
+    return {rbegin(), rend()};
+  }
 
   // List Functions
   list();             // empty list
+  explicit list(const Allocator& alloc);
   list(size_type n);  // parameterized size(n) constructor
+  list(size_type n, const_reference value);
+  template <typename InputIt,
+            typename = detail::require_input_iterator<InputIt>>
+  list(InputIt first, InputIt last);
   list(std::initializer_list<value_type> const&
            items);  // list initizialized using std::initializer_list {a, b, c,
                     // ...}
@@ -99,6 +418,14 @@ class list {
   list& operator=(list&& l);
   list& operator=(const list& l);
 
+  allocator_type get_allocator() const {
+    return allocator_type(node_alloc());
+  }
+
+  // Counters of the Stats policy; all zero with the default no_stats
+  using Stats::reset_stats;
+  using Stats::stats;
+
   // List Element access
   const_reference front();
   const_reference back();
@@ -110,21 +437,106 @@ class list {
 
   // Modifiers
   void clear();
-  iterator insert(iterator pos, const_reference value);
-  void erase(iterator pos);
+  iterator insert(const_iterator pos, const_reference value);
+  iterator insert(const_iterator pos, value_type&& value);
+  // Bulk inserts build the new nodes aside and link them in at once: if a
+  // copy throws, the list is left unchanged
+  iterator insert(const_iterator pos, size_type n, const_reference value);
+  template <typename InputIt,
+            typename = detail::require_input_iterator<InputIt>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last);
+  iterator insert(const_iterator pos, std::initializer_list<value_type> items);
+  void assign(size_type n, const_reference value);
+  template <typename InputIt,
+            typename = detail::require_input_iterator<InputIt>>
+  void assign(InputIt first, InputIt last);
+  void assign(std::initializer_list<value_type> items);
+  void erase(const_iterator pos);
+  // Unlinks the element at pos without freeing or moving it. Inserting the
+  // handle into a list with an equal allocator only relinks the node; with
+  // any other allocator the value is moved into a new node.
+  node_type extract(const_iterator pos);
+  iterator insert(const_iterator pos, node_type&& handle);
   void push_back(const_reference value);
+  void push_back(value_type&& value);
   void pop_back();
   void push_front(const_reference value);
+  void push_front(value_type&& value);
   void pop_front();
   void swap(list& other);
   void merge(list& other);
+  template <typename Compare>
+  void merge(list& other, Compare comp);  // stable, relinks nodes only
   void splice(const_iterator pos, list& other);
+  void splice(const_iterator pos, list& other, const_iterator it);
+  void splice(const_iterator pos, list& other, const_iterator first,
+              const_iterator last);
   void reverse();  // reverses the order of the elements
-  void unique();   // removes consecutive duplicate elements
+  // Single pass, relinking only. The removed nodes are unlinked first and
+  // freed once the pass is over, so value may refer into the list.
+  void remove(const_reference value);
+  template <typename UnaryPredicate>
+  void remove_if(UnaryPredicate pred);
+  void unique();  // removes consecutive duplicate elements
+  template <typename BinaryPredicate>
+  void unique(BinaryPredicate pred);
+  // Removes every later occurrence of a value, adjacent or not, keeping the
+  // first one. O(n) expected with a temporary open-addressing hash set.
+  template <typename Hash = std::hash<T>, typename KeyEqual = std::equal_to<T>>
+  void dedupe(Hash hash = Hash(), KeyEqual equal = KeyEqual());
   void sort();
-
-  // Additional modifiers
-  Node* merge(Node* left, Node* right);
+  template <typename Compare>
+  void sort(Compare comp);  // stable, relinks nodes only
+  void sort(const execution::parallel_policy& policy);
+  template <typename Compare>
+  void sort(const execution::parallel_policy& policy, Compare comp);
+
+  // Relinks the list so that a walk visits ascending addresses, to undo the
+  // scattering left by long insert/erase churn. Invalidates all iterators,
+  // pointers and references to elements.
+  void compact();
+  // Calls compact() if the allocator reports that its nodes have scattered
+  // past its compact ratio, and returns whether it did. Never called by
+  // the modifiers, so erase only invalidates the erased element.
+  bool compact_if_needed();
+
+  // Binary persistence for trivially copyable T. load() and load_mapped()
+  // replace the contents and leave the list unchanged if the input is bad.
+  void save(std::ostream& os) const;
+  void load(std::istream& is);
+  void load_mapped(const std::string& path);
+
+  // Scans in list order; built with S21_LIST_PREFETCH_DISTANCE > 0 they
+  // prefetch that many nodes ahead of the element being visited
+  template <typename F>
+  F for_each(F f);
+  template <typename F>
+  F for_each(F f) const;
+  template <typename U, typename BinaryOp = std::plus<>>
+  U accumulate(U init, BinaryOp op = BinaryOp()) const;
+  template <typename Pred>
+  iterator find_if(Pred pred);
+  template <typename Pred>
+  const_iterator find_if(Pred pred) const;
+  // Calls f(items, count) with pointers to the next count <= n elements
+  // (n is clamped to [1, kMaxBatch]), for kernels that work on a batch
+  static constexpr size_type kMaxBatch = 64;
+  template <typename F>
+  void for_each_batch(size_type n, F f);
+  template <typename F>
+  void for_each_batch(size_type n, F f) const;
+
+  // Searches and comparisons by operator== and operator<. For arithmetic T
+  // the values are copied out of the nodes a block at a time and compared
+  // with vector instructions. min() and max() throw on an empty list.
+  iterator find(const_reference value);
+  const_iterator find(const_reference value) const;
+  size_type count(const_reference value) const;
+  bool contains(const_reference value) const;
+  value_type min() const;
+  value_type max() const;
+  bool operator==(const list& other) const;
+  bool operator!=(const list& other) const;
 
   // // Bonus functions
   template <class... Args>
@@ -135,388 +547,1330 @@ class list {
 
   template <class... Args>
   void emplace_front(Args&&... args);
+
+ private:
+  // Smallest run worth a thread of its own in the parallel sort
+  static constexpr size_type kParallelSortGrain = 8192;
+  // Values staged per write() or read() call in save and load
+  static constexpr size_type kLoadBlock = 4096;
+  // Values copied out of the nodes per call of a vector kernel
+  static constexpr size_type kSimdBlock = 64;
+  // How many nodes the scans prefetch ahead of the one being visited
+  static constexpr size_type kPrefetchDistance = S21_LIST_PREFETCH_DISTANCE;
+
+  // Adapts comp on values to the hook comparison of the detail algorithms.
+  // Calls are counted into calls only when the Stats policy is enabled.
+  template <typename Compare>
+  static auto by_value(Compare& comp, std::uint64_t& calls) {
+    return [&comp, &calls](NodeBase* a, NodeBase* b) {
+      if constexpr (Stats::enabled) calls++;
+      return comp(value(a), value(b));
+    };
+  }
+
+  // Detached run of new nodes linked by next and prev, not yet in the list
+  struct Chain {
+    NodeBase* head = nullptr;
+    NodeBase* tail = nullptr;
+    size_type size = 0;
+  };
+
+  template <typename Visit>
+  NodeBase* scan(Visit&& visit) const;
+  template <typename Item, typename F>
+  void batch(size_type n, F& f) const;
+  template <typename Kernel>
+  void for_each_block(Kernel&& kernel) const;
+  NodeBase* find_node(const_reference value) const;
+  template <bool Less>
+  value_type extreme() const;
+
+  template <class... Args>
+  Node* create_node(Args&&... args);
+  void destroy_node(NodeBase* node);
+  void destroy_nodes();
+  void erase_node(NodeBase* node);
+  Chain moved_chain();
+  void relocate_nodes(node_allocator target);
+  void order_by_address();
+  void erase_to_end(NodeBase* first);
+  template <class... Args>
+  Chain make_chain(size_type n, const Args&... args);
+  template <typename InputIt>
+  Chain make_chain(InputIt first, InputIt last);
+  template <class... Args>
+  void chain_append(Chain& chain, Args&&... args);
+  void chain_append_raw(Chain& chain, const unsigned char* data,
+                        size_type count);
+  void destroy_chain(Chain& chain);
+  // Unlinks node from the list onto the front of a chain to be freed later
+  void unlink_to(Chain& removed, NodeBase* node);
+  iterator link_chain(NodeBase* pos, Chain& chain);
+  void reset_sentinel();
+  void adopt_sentinel();
+  void steal_nodes(list& other);
+  void transfer(NodeBase* pos, list& other, NodeBase* first, NodeBase* last,
+                size_type count);
 };
 }  // namespace s21
 
 namespace s21 {
 
-template <typename T>
-list<T>::list() : head(nullptr), tail(nullptr), list_size(0) {}
+template <typename T, typename Allocator, typename Stats>
+list<T, Allocator, Stats>::list() : list(Allocator()) {}
 
-template <typename T>
-list<T>::list(size_type n) : head(nullptr), tail(nullptr), list_size(0) {
-  for (size_type i = 0; i < n; i++) {
-    push_back(value_type());
-  }
+template <typename T, typename Allocator, typename Stats>
+list<T, Allocator, Stats>::list(const Allocator& alloc)
+    : alloc_holder(node_allocator(alloc)),
+      sentinel_{&sentinel_, &sentinel_},
+      list_size(0) {}
+
+template <typename T, typename Allocator, typename Stats>
+list<T, Allocator, Stats>::list(size_type n) : list() {
+  Chain chain = make_chain(n);
+  link_chain(&sentinel_, chain);
 }
 
-template <typename T>
-list<T>::list(std::initializer_list<value_type> const& items)
-    : head(nullptr), tail(nullptr), list_size(0) {
-  for (const auto& item : items) {
-    this->push_back(item);
-  }
+template <typename T, typename Allocator, typename Stats>
+list<T, Allocator, Stats>::list(size_type n, const_reference value) : list() {
+  Chain chain = make_chain(n, value);
+  link_chain(&sentinel_, chain);
 }
 
-template <typename T>
-list<T>::list(const list& l) : list() {
+template <typename T, typename Allocator, typename Stats>
+template <typename InputIt, typename>
+list<T, Allocator, Stats>::list(InputIt first, InputIt last) : list() {
+  Chain chain = make_chain(first, last);
+  link_chain(&sentinel_, chain);
+}
+
+template <typename T, typename Allocator, typename Stats>
+list<T, Allocator, Stats>::list(std::initializer_list<value_type> const& items)
+    : list(items.begin(), items.end()) {}
+
+template <typename T, typename Allocator, typename Stats>
+list<T, Allocator, Stats>::list(const list& l)
+    : list(node_traits::select_on_container_copy_construction(
+          l.node_alloc())) {
   *this = l;
 }
 
-template <typename T>
-list<T>::list(list&& l) : list() {
-  this->swap(l);
+template <typename T, typename Allocator, typename Stats>
+list<T, Allocator, Stats>::list(list&& l) : list(l.node_alloc()) {
+  steal_nodes(l);
 }
 
-template <typename T>
-list<T>::~list() {
+template <typename T, typename Allocator, typename Stats>
+list<T, Allocator, Stats>::~list() {
   clear();
 }
 
-template <typename T>
-list<T>& list<T>::operator=(list&& other) {
-  this->swap(other);
+template <typename T, typename Allocator, typename Stats>
+list<T, Allocator, Stats>& list<T, Allocator, Stats>::operator=(list&& other) {
+  if (this == &other) return *this;
+  this->clear();
+  if (node_traits::propagate_on_container_move_assignment::value ||
+      node_alloc() == other.node_alloc()) {
+    if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+      node_alloc() = other.node_alloc();
+    }
+    steal_nodes(other);
+  } else {
+    // Nodes cannot change hands between unequal allocators
+    for (NodeBase* it = other.sentinel_.next; it != &other.sentinel_;
+         it = it->next) {
+      push_back(std::move(value(it)));
+    }
+    other.clear();
+  }
   return *this;
 }
 
-template <typename T>
-list<T>& list<T>::operator=(const list& other) {
+template <typename T, typename Allocator, typename Stats>
+list<T, Allocator, Stats>& list<T, Allocator, Stats>::operator=(
+    const list& other) {
   if (this == &other) return *this;
-  this->clear();
-  list_size = 0;
-  for (Node* it = other.head; it != nullptr; it = it->next) {
-    push_back(it->data);
+  if constexpr (node_traits::propagate_on_container_copy_assignment::value) {
+    // Our nodes must go back to the allocator that made them
+    if (!(node_alloc() == other.node_alloc())) clear();
+    node_alloc() = other.node_alloc();
   }
+  assign(other.begin(), other.end());
   return *this;
 }
 
-template <typename T>
-typename list<T>::const_reference list<T>::front() {
+template <typename T, typename Allocator, typename Stats>
+typename list<T, Allocator, Stats>::const_reference
+list<T, Allocator, Stats>::front() {
   if (size() == 0) {
     throw "out_of_range";
   }
-  return head->data;
+  return value(sentinel_.next);
 }
 
-template <typename T>
-typename list<T>::const_reference list<T>::back() {
+template <typename T, typename Allocator, typename Stats>
+typename list<T, Allocator, Stats>::const_reference
+list<T, Allocator, Stats>::back() {
   if (size() == 0) {
     throw "out_of_range";
   }
-  return tail->data;
+  return value(sentinel_.prev);
 }
 
-template <typename T>
-bool list<T>::empty() {
+template <typename T, typename Allocator, typename Stats>
+bool list<T, Allocator, Stats>::empty() {
   return !list_size;
 }
 
-template <typename T>
-typename list<T>::size_type list<T>::size() {
+template <typename T, typename Allocator, typename Stats>
+typename list<T, Allocator, Stats>::size_type
+list<T, Allocator, Stats>::size() {
   return list_size;
 }
 
-template <typename T>
-typename list<T>::size_type list<T>::max_size() {
+template <typename T, typename Allocator, typename Stats>
+typename list<T, Allocator, Stats>::size_type
+list<T, Allocator, Stats>::max_size() {
   return std::numeric_limits<size_type>::max() / sizeof(Node) / 2;
 }
 
-template <typename T>
-void list<T>::clear() {
-  while (head) {
-    Node* next = head->next;
-    delete head;
-    head = next;
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::clear() {
+  if constexpr (std::is_trivially_destructible_v<value_type> &&
+                detail::has_bulk_release<node_allocator>::value) {
+    if (node_alloc().exclusive()) {
+      // Nothing to destroy and nobody else owns the pool: drop whole chunks
+      Stats::on_free(list_size);
+      node_alloc().release_all();
+      reset_sentinel();
+      return;
+    }
   }
-  tail = nullptr;
-  list_size = 0;
+  if constexpr (std::is_trivially_destructible_v<value_type>) {
+    if (detail::deallocate_is_noop(node_alloc())) {
+      // The resource frees everything at once later; skip the walk
+      Stats::on_free(list_size);
+      reset_sentinel();
+      return;
+    }
+  }
+  destroy_nodes();
 }
 
-template <typename T>
-typename list<T>::iterator list<T>::insert(iterator pos,
-                                           const_reference value) {
-  Node* tmp = pos.n_current;
-  Node* newNode = new Node(value);
-
-  if (!head) {
-    // Пустой список
-    head = tail = newNode;
-    push_back(value);
-  } else if (tmp == tail) {
-    // Вставка в конец
-    push_back(value);
-    delete newNode;
-    return iterator(tail);
-  } else if (tmp == head) {
-    // Вставка в начало
-    push_front(value);
-    delete newNode;
-    return iterator(head);
-  } else {
-    // Вставка в середину
-    newNode->next = tmp;
-    newNode->prev = tmp->prev;
-    if (tmp->prev) {
-      tmp->prev->next = newNode;
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::erase_node(NodeBase* node) {
+  detail::unlink_range(node, node);
+  destroy_node(node);
+  list_size--;
+}
+
+// New nodes from node_alloc(), in list order, holding the values moved out
+// of the list (copied if moving may throw). On failure the list is left as
+// it was.
+template <typename T, typename Allocator, typename Stats>
+typename list<T, Allocator, Stats>::Chain
+list<T, Allocator, Stats>::moved_chain() {
+  Chain chain;
+  try {
+    for (NodeBase* it = sentinel_.next; it != &sentinel_; it = it->next) {
+      chain_append(chain, std::move_if_noexcept(value(it)));
     }
-    tmp->prev = newNode;
-    list_size++;
+  } catch (...) {
+    destroy_chain(chain);
+    throw;
   }
-  return iterator(newNode);
+  return chain;
 }
 
-template <typename T>
-void list<T>::erase(iterator pos) {
-  Node* tmp = pos.n_current;
+// Rebuilds the list from nodes of target. The old nodes go back to the old
+// allocator, which is then replaced by target. If a move or an allocation
+// throws, the list keeps its old nodes.
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::relocate_nodes(node_allocator target) {
+  std::swap(node_alloc(), target);
+  Chain chain;
+  try {
+    chain = moved_chain();
+  } catch (...) {
+    std::swap(node_alloc(), target);
+    throw;
+  }
+  std::swap(node_alloc(), target);
+  destroy_nodes();
+  node_alloc() = std::move(target);
+  link_chain(&sentinel_, chain);
+}
 
-  if (tmp == nullptr) {
-    throw "out_of_range";
+// The value of the i-th node in list order belongs in the i-th lowest
+// address. Each cycle of that permutation is rotated through one temporary,
+// then the nodes are relinked in address order.
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::order_by_address() {
+  std::vector<NodeBase*> order;
+  order.reserve(list_size);
+  for (NodeBase* it = sentinel_.next; it != &sentinel_; it = it->next) {
+    order.push_back(it);
   }
+  std::vector<NodeBase*> slots(order);
+  std::sort(slots.begin(), slots.end(), std::less<NodeBase*>());
+  std::vector<bool> done(list_size);
+  auto slot_of = [&slots](NodeBase* node) {
+    return static_cast<size_type>(
+        std::lower_bound(slots.begin(), slots.end(), node,
+                         std::less<NodeBase*>()) -
+        slots.begin());
+  };
 
-  if (tmp == head) {
-    // Удаление головы
-    head = head->next;
-    if (head) {
-      head->prev = nullptr;
-    } else {
-      tail = nullptr;  // Список пуст
-    }
-  } else {
-    if (tmp == tail) {
-      // Удаление хвоста
-      tail = tail->prev;
-      tail->next = nullptr;
-    } else {
-      // Удаление из середины
-      tmp->prev->next = tmp->next;
-      tmp->next->prev = tmp->prev;
+  for (size_type i = 0; i < list_size; i++) {
+    if (done[i] || order[i] == slots[i]) continue;
+    NodeBase* start = slots[i];
+    value_type carried(std::move(value(start)));
+    size_type j = i;
+    while (order[j] != start) {
+      value(slots[j]) = std::move(value(order[j]));
+      done[j] = true;
+      j = slot_of(order[j]);
     }
+    value(slots[j]) = std::move(carried);
+    done[j] = true;
   }
+  Stats::on_visit(list_size);
 
-  delete tmp;
-  list_size--;
+  for (size_type i = 0; i + 1 < list_size; i++) slots[i]->next = slots[i + 1];
+  slots.back()->next = nullptr;
+  detail::adopt_chain(&sentinel_, slots.front());
 }
 
-template <typename T>
-void list<T>::push_back(const_reference value) {
-  Node* newNode = new Node(value);
-  if (!head) {
-    head = tail = newNode;
+// Frees first and everything after it
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::erase_to_end(NodeBase* first) {
+  if (first == &sentinel_) return;
+  detail::unlink_range(first, sentinel_.prev);
+  size_type visits = 0;
+  while (first != &sentinel_) {
+    NodeBase* next = first->next;
+    destroy_node(first);
+    list_size--;
+    visits++;
+    first = next;
+  }
+  Stats::on_visit(visits);
+}
+
+// Node by node, unlike the bulk path of clear() this leaves other nodes of
+// the same pool alone
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::destroy_nodes() {
+  NodeBase* current = sentinel_.next;
+  while (current != &sentinel_) {
+    NodeBase* next = current->next;
+    destroy_node(current);
+    current = next;
+  }
+  Stats::on_visit(list_size);
+  reset_sentinel();
+}
+
+template <typename T, typename Allocator, typename Stats>
+typename list<T, Allocator, Stats>::iterator list<T, Allocator, Stats>::insert(
+    const_iterator pos, const_reference value) {
+  return emplace(pos, value);
+}
+
+template <typename T, typename Allocator, typename Stats>
+typename list<T, Allocator, Stats>::iterator list<T, Allocator, Stats>::insert(
+    const_iterator pos, value_type&& value) {
+  return emplace(pos, std::move(value));
+}
+
+template <typename T, typename Allocator, typename Stats>
+typename list<T, Allocator, Stats>::iterator list<T, Allocator, Stats>::insert(
+    const_iterator pos, size_type n, const_reference value) {
+  Chain chain = make_chain(n, value);
+  return link_chain(pos.n_current, chain);
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename InputIt, typename>
+typename list<T, Allocator, Stats>::iterator list<T, Allocator, Stats>::insert(
+    const_iterator pos, InputIt first, InputIt last) {
+  Chain chain = make_chain(first, last);
+  return link_chain(pos.n_current, chain);
+}
+
+template <typename T, typename Allocator, typename Stats>
+typename list<T, Allocator, Stats>::iterator list<T, Allocator, Stats>::insert(
+    const_iterator pos, std::initializer_list<value_type> items) {
+  return insert(pos, items.begin(), items.end());
+}
+
+// Existing nodes are overwritten in place, only the surplus is allocated
+// and only the excess freed. A throwing copy leaves a valid list holding a
+// mix of old and new values; the surplus is still linked all or nothing.
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::assign(size_type n, const_reference item) {
+  if constexpr (std::is_copy_assignable_v<value_type>) {
+    NodeBase* current = sentinel_.next;
+    size_type visits = 0;
+    for (; current != &sentinel_ && n; current = current->next, n--) {
+      value(current) = item;
+      visits++;
+    }
+    Stats::on_visit(visits);
+    Chain chain = make_chain(n, item);
+    erase_to_end(current);
+    link_chain(&sentinel_, chain);
   } else {
-    tail->next = newNode;
-    newNode->prev = tail;
-    tail = newNode;
+    Chain chain = make_chain(n, item);
+    destroy_nodes();
+    link_chain(&sentinel_, chain);
   }
-  list_size++;
 }
 
-template <typename T>
-void list<T>::pop_back() {
-  if (list_size == 0) {
+template <typename T, typename Allocator, typename Stats>
+template <typename InputIt, typename>
+void list<T, Allocator, Stats>::assign(InputIt first, InputIt last) {
+  if constexpr (std::is_copy_assignable_v<value_type>) {
+    NodeBase* current = sentinel_.next;
+    size_type visits = 0;
+    for (; current != &sentinel_ && first != last; current = current->next) {
+      value(current) = *first;
+      ++first;
+      visits++;
+    }
+    Stats::on_visit(visits);
+    Chain chain = make_chain(first, last);
+    erase_to_end(current);
+    link_chain(&sentinel_, chain);
+  } else {
+    Chain chain = make_chain(first, last);
+    destroy_nodes();
+    link_chain(&sentinel_, chain);
+  }
+}
+
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::assign(
+    std::initializer_list<value_type> items) {
+  assign(items.begin(), items.end());
+}
+
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::erase(const_iterator pos) {
+  NodeBase* tmp = pos.n_current;
+  if (tmp == &sentinel_) {
     throw "out_of_range";
   }
-  Node* oldTail = tail;
-  if (head == tail) {  // Один элемент
-    head = tail = nullptr;
-  } else {
-    tail = tail->prev;
-    tail->next = nullptr;
+  erase_node(tmp);
+}
+
+template <typename T, typename Allocator, typename Stats>
+typename list<T, Allocator, Stats>::node_type
+list<T, Allocator, Stats>::extract(const_iterator pos) {
+  NodeBase* node = pos.n_current;
+  if (node == &sentinel_) {
+    throw "out_of_range";
   }
-  delete oldTail;
+  detail::unlink_range(node, node);
   list_size--;
+  return node_type(static_cast<Node*>(node), node_alloc());
 }
 
-template <typename T>
-void list<T>::push_front(const_reference value) {
-  Node* newNode = new Node(value);
-  if (!head) {
-    head = tail = newNode;
-  } else {
-    head->prev = newNode;
-    newNode->next = head;
-    head = newNode;
+template <typename T, typename Allocator, typename Stats>
+typename list<T, Allocator, Stats>::iterator list<T, Allocator, Stats>::insert(
+    const_iterator pos, node_type&& handle) {
+  if (handle.empty()) return iterator(pos.n_current);
+  if (!(*handle.alloc_ == node_alloc())) {
+    iterator inserted = emplace(pos, std::move(handle.value()));
+    handle.reset();
+    return inserted;
   }
+  Node* node = handle.release();
+  detail::link_range(pos.n_current, node, node);
   list_size++;
+  Stats::on_size(list_size);
+  return iterator(node);
 }
 
-template <typename T>
-void list<T>::pop_front() {
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::push_back(value_type&& value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::pop_back() {
   if (list_size == 0) {
     throw "out_of_range";
   }
-  Node* oldHead = head;
-  if (head == tail) {  // Один элемент
-    head = tail = nullptr;
-  } else {
-    head = head->next;
-    head->prev = nullptr;
+  erase(iterator(sentinel_.prev));
+}
+
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::push_front(const_reference value) {
+  emplace_front(value);
+}
+
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::push_front(value_type&& value) {
+  emplace_front(std::move(value));
+}
+
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::pop_front() {
+  if (list_size == 0) {
+    throw "out_of_range";
   }
-  delete oldHead;
-  list_size--;
+  erase(iterator(sentinel_.next));
 }
 
-template <typename T>
-void list<T>::swap(list& other) {
-  std::swap(head, other.head);
-  std::swap(tail, other.tail);
+// Allocators that stay with their lists must compare equal for the nodes
+// to change hands; otherwise every value is moved across, as in operator=.
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::swap(list& other) {
+  if constexpr (node_traits::propagate_on_container_swap::value) {
+    using std::swap;
+    swap(node_alloc(), other.node_alloc());
+  } else if (!(node_alloc() == other.node_alloc())) {
+    list mine(node_alloc());
+    mine = std::move(other);
+    other = std::move(*this);
+    *this = std::move(mine);
+    return;
+  }
+  std::swap(sentinel_, other.sentinel_);
   std::swap(list_size, other.list_size);
+  adopt_sentinel();
+  other.adopt_sentinel();
+  Stats::on_size(list_size);
+  other.on_size(other.list_size);
 }
 
-template <typename T>
-void list<T>::merge(list& other) {
-  // Временный узел от которого пойдет результирующий список
-  Node* dummy = new Node(value_type());
-  Node* tail = dummy;
-
-  // Указалетели на головы списков
-  Node* first = head;
-  Node* second = other.head;
-
-  // Перебор двух сортированных списков в один
-  while (first != nullptr && second != nullptr) {
-    if (first->data <= second->data) {
-      tail->next = first;
-      first->prev = tail;
-      first = first->next;
-    } else {
-      tail->next = second;
-      second->prev = tail;
-      second = second->next;
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::merge(list& other) {
+  merge(other, std::less<value_type>());
+}
+
+// On equal keys the nodes of *this come first
+template <typename T, typename Allocator, typename Stats>
+template <typename Compare>
+void list<T, Allocator, Stats>::merge(list& other, Compare comp) {
+  if (&other == this || other.empty()) return;
+  std::uint64_t comparisons = 0;
+  auto less = by_value(comp, comparisons);
+  if (node_alloc() == other.node_alloc()) {
+    detail::merge_rings(&sentinel_, list_size, &other.sentinel_,
+                        other.list_size, less);
+  } else {
+    // Nodes cannot change hands between unequal allocators
+    NodeBase* pos = sentinel_.next;
+    while (!other.empty()) {
+      NodeBase* next = other.sentinel_.next;
+      while (pos != &sentinel_ && !less(next, pos)) pos = pos->next;
+      emplace(iterator(pos), std::move(value(next)));
+      other.erase_node(next);
+    }
+  }
+  Stats::on_compare(comparisons);
+  Stats::on_size(list_size);
+}
+
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::splice(const_iterator pos, list& other) {
+  if (&other == this || other.empty()) return;
+  transfer(pos.n_current, other, other.sentinel_.next, other.sentinel_.prev,
+           other.list_size);
+}
+
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::splice(const_iterator pos, list& other,
+                                       const_iterator it) {
+  transfer(pos.n_current, other, it.n_current, it.n_current, 1);
+}
+
+// O(1) within one list, otherwise O(1) plus counting the moved range
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::splice(const_iterator pos, list& other,
+                                       const_iterator first,
+                                       const_iterator last) {
+  NodeBase* begin = first.n_current;
+  NodeBase* end = last.n_current;
+  if (begin == end) return;
+  size_type count = 0;
+  if (&other != this) {
+    for (NodeBase* it = begin; it != end; it = it->next) count++;
+    Stats::on_visit(count);
+  }
+  transfer(pos.n_current, other, begin, end->prev, count);
+}
+
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::reverse() {
+  detail::reverse_ring(&sentinel_);
+}
+
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::remove(const_reference value) {
+  remove_if([&value](const_reference item) { return item == value; });
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename UnaryPredicate>
+void list<T, Allocator, Stats>::remove_if(UnaryPredicate pred) {
+  Chain removed;
+  NodeBase* current = sentinel_.next;
+  size_type visited = 0;
+  try {
+    while (current != &sentinel_) {
+      NodeBase* next = current->next;
+      visited++;
+      if (pred(value(current))) {
+        unlink_to(removed, current);
+      }
+      current = next;
     }
-    tail = tail->next;
+  } catch (...) {
+    destroy_chain(removed);
+    Stats::on_visit(visited);
+    throw;
   }
+  destroy_chain(removed);
+  Stats::on_visit(visited);
+}
+
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::unique() {
+  unique(std::equal_to<value_type>());
+}
 
-  // Добавление оставшихся элементов (если есть)
-  tail->next = (first != nullptr) ? first : second;
-  if (tail->next) {
-    tail->next->prev = tail;
+// pred(kept, next) is asked for each node against the last node kept
+template <typename T, typename Allocator, typename Stats>
+template <typename BinaryPredicate>
+void list<T, Allocator, Stats>::unique(BinaryPredicate pred) {
+  if (list_size < 2) return;
+  Chain removed;
+  NodeBase* current = sentinel_.next;
+  size_type comparisons = 0;
+  try {
+    while (current->next != &sentinel_) {
+      NodeBase* next = current->next;
+      comparisons++;
+      if (pred(value(current), value(next))) {
+        unlink_to(removed, next);
+      } else {
+        current = next;
+      }
+    }
+  } catch (...) {
+    destroy_chain(removed);
+    Stats::on_compare(comparisons);
+    Stats::on_visit(comparisons + 1);
+    throw;
   }
+  destroy_chain(removed);
+  Stats::on_compare(comparisons);
+  Stats::on_visit(comparisons + 1);
+}
 
-  // Обновление указателей head и tail для this
-  head = dummy->next;
-  if (head) {
-    head->prev = nullptr;
+// The set holds the nodes kept so far, probed linearly from a Fibonacci
+// scramble of their hash (std::hash of an integer is the identity). Its
+// capacity is a power of two of at least twice the size, so it never grows
+// and a probe run stays short.
+template <typename T, typename Allocator, typename Stats>
+template <typename Hash, typename KeyEqual>
+void list<T, Allocator, Stats>::dedupe(Hash hash, KeyEqual equal) {
+  if (list_size < 2) return;
+  struct Slot {
+    std::size_t hash;
+    NodeBase* node;
+  };
+  int bits = 1;
+  while ((std::size_t(1) << bits) < list_size * 2) bits++;
+  const std::size_t capacity = std::size_t(1) << bits;
+  const std::size_t mask = capacity - 1;
+  std::vector<Slot> slots(capacity, Slot{0, nullptr});
+
+  Chain removed;
+  NodeBase* current = sentinel_.next;
+  std::uint64_t comparisons = 0;
+  try {
+    while (current != &sentinel_) {
+      NodeBase* next = current->next;
+      const std::size_t h = hash(value(current));
+      std::size_t i = static_cast<std::size_t>(
+          (std::uint64_t(h) * 0x9E3779B97F4A7C15ULL) >> (64 - bits));
+      bool seen = false;
+      for (; slots[i].node; i = (i + 1) & mask) {
+        if (slots[i].hash != h) continue;
+        comparisons++;
+        if (equal(value(slots[i].node), value(current))) {
+          seen = true;
+          break;
+        }
+      }
+      if (seen) {
+        unlink_to(removed, current);
+      } else {
+        slots[i] = Slot{h, current};
+      }
+      current = next;
+    }
+  } catch (...) {
+    destroy_chain(removed);
+    Stats::on_compare(comparisons);
+    throw;
   }
-  while (tail->next != nullptr) {
-    tail = tail->next;
+  Stats::on_visit(list_size + removed.size);
+  destroy_chain(removed);
+  Stats::on_compare(comparisons);
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename F>
+F list<T, Allocator, Stats>::for_each(F f) {
+  scan([&f](NodeBase* node) {
+    f(value(node));
+    return false;
+  });
+  return f;
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename F>
+F list<T, Allocator, Stats>::for_each(F f) const {
+  scan([&f](NodeBase* node) {
+    f(static_cast<const_reference>(value(node)));
+    return false;
+  });
+  return f;
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename U, typename BinaryOp>
+U list<T, Allocator, Stats>::accumulate(U init, BinaryOp op) const {
+  scan([&init, &op](NodeBase* node) {
+    init = op(std::move(init), static_cast<const_reference>(value(node)));
+    return false;
+  });
+  return init;
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename Pred>
+typename list<T, Allocator, Stats>::iterator
+list<T, Allocator, Stats>::find_if(Pred pred) {
+  return iterator(scan([&pred](NodeBase* node) { return pred(value(node)); }));
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename Pred>
+typename list<T, Allocator, Stats>::const_iterator
+list<T, Allocator, Stats>::find_if(Pred pred) const {
+  return const_iterator(scan([&pred](NodeBase* node) {
+    return pred(static_cast<const_reference>(value(node)));
+  }));
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename F>
+void list<T, Allocator, Stats>::for_each_batch(size_type n, F f) {
+  batch<value_type>(n, f);
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename F>
+void list<T, Allocator, Stats>::for_each_batch(size_type n, F f) const {
+  batch<const value_type>(n, f);
+}
+
+template <typename T, typename Allocator, typename Stats>
+typename list<T, Allocator, Stats>::iterator list<T, Allocator, Stats>::find(
+    const_reference value) {
+  return iterator(find_node(value));
+}
+
+template <typename T, typename Allocator, typename Stats>
+typename list<T, Allocator, Stats>::const_iterator
+list<T, Allocator, Stats>::find(const_reference value) const {
+  return const_iterator(find_node(value));
+}
+
+template <typename T, typename Allocator, typename Stats>
+typename list<T, Allocator, Stats>::size_type list<T, Allocator, Stats>::count(
+    const_reference value) const {
+  size_type count = 0;
+  if constexpr (detail::is_simd_value<value_type>) {
+    for_each_block([&](const value_type* values, size_type n, NodeBase*) {
+      count += detail::simd_count(values, n, value);
+      return false;
+    });
+  } else {
+    scan([&](NodeBase* node) {
+      count += list::value(node) == value;
+      return false;
+    });
   }
-  this->tail = tail;
+  return count;
+}
 
-  // Очистка списка other
-  other.head = other.tail = nullptr;
-  other.list_size = 0;
-  delete dummy;
+template <typename T, typename Allocator, typename Stats>
+bool list<T, Allocator, Stats>::contains(const_reference value) const {
+  return find_node(value) != &sentinel_;
 }
 
-template <typename T>
-void list<T>::splice(const_iterator pos, list& other) {
-  iterator tmp = pos;
-  iterator it = other.begin();
-  for (size_t i = 0; i < other.size(); ++i) {
-    tmp = insert(tmp, *it);
-    ++tmp;
-    ++it;
+template <typename T, typename Allocator, typename Stats>
+typename list<T, Allocator, Stats>::value_type list<T, Allocator, Stats>::min()
+    const {
+  return extreme<true>();
+}
+
+template <typename T, typename Allocator, typename Stats>
+typename list<T, Allocator, Stats>::value_type list<T, Allocator, Stats>::max()
+    const {
+  return extreme<false>();
+}
+
+template <typename T, typename Allocator, typename Stats>
+bool list<T, Allocator, Stats>::operator==(const list& other) const {
+  if (list_size != other.list_size) return false;
+  const NodeBase* end = &sentinel_;
+  NodeBase* left = sentinel_.next;
+  NodeBase* right = other.sentinel_.next;
+  if constexpr (detail::is_simd_value<value_type>) {
+    value_type a[kSimdBlock];
+    value_type b[kSimdBlock];
+    while (left != end) {
+      size_type n = 0;
+      for (; n < kSimdBlock && left != end; n++) {
+        a[n] = value(left);
+        b[n] = value(right);
+        left = left->next;
+        right = right->next;
+      }
+      if (!detail::simd_equal(a, b, n)) return false;
+    }
+  } else {
+    for (; left != end; left = left->next, right = right->next) {
+      if (!(value(left) == value(right))) return false;
+    }
   }
-  other.clear();
+  return true;
 }
 
-template <typename T>
-void list<T>::reverse() {
-  Node* current = head;
-  Node* temp = nullptr;
+template <typename T, typename Allocator, typename Stats>
+bool list<T, Allocator, Stats>::operator!=(const list& other) const {
+  return !(*this == other);
+}
 
-  while (current != nullptr) {
-    temp = current->prev;
-    current->prev = current->next;
-    current->next = temp;
-    current = current->prev;
+// Copies the values into blocks of up to kSimdBlock and calls
+// kernel(values, n, first), first being the node of values[0], until the
+// kernel returns true
+template <typename T, typename Allocator, typename Stats>
+template <typename Kernel>
+void list<T, Allocator, Stats>::for_each_block(Kernel&& kernel) const {
+  value_type values[kSimdBlock];
+  NodeBase* first = nullptr;
+  size_type n = 0;
+  NodeBase* stop = scan([&](NodeBase* node) {
+    if (n == 0) first = node;
+    values[n++] = value(node);
+    if (n < kSimdBlock) return false;
+    n = 0;
+    return kernel(static_cast<const value_type*>(values), kSimdBlock, first);
+  });
+  if (stop == &sentinel_ && n) {
+    kernel(static_cast<const value_type*>(values), n, first);
   }
+}
 
-  if (temp != nullptr) {
-    head = temp->prev;
+template <typename T, typename Allocator, typename Stats>
+typename list<T, Allocator, Stats>::NodeBase*
+list<T, Allocator, Stats>::find_node(const_reference value) const {
+  if constexpr (detail::is_simd_value<value_type>) {
+    NodeBase* found = const_cast<NodeBase*>(&sentinel_);
+    for_each_block([&](const value_type* values, size_type n, NodeBase* node) {
+      size_type i = detail::simd_find(values, n, value);
+      if (i == n) return false;
+      for (found = node; i; i--) found = found->next;
+      return true;
+    });
+    return found;
+  } else {
+    return scan([&](NodeBase* node) { return list::value(node) == value; });
   }
 }
 
-template <typename T>
-void list<T>::unique() {
-  if (!head) {
-    throw "out_of_range";
+template <typename T, typename Allocator, typename Stats>
+template <bool Less>
+typename list<T, Allocator, Stats>::value_type
+list<T, Allocator, Stats>::extreme() const {
+  if (!list_size) throw "out_of_range";
+  value_type best = value(sentinel_.next);
+  if constexpr (detail::is_simd_value<value_type>) {
+    for_each_block([&](const value_type* values, size_type n, NodeBase*) {
+      best = detail::simd_extreme<Less>(values, n, best);
+      return false;
+    });
+  } else {
+    scan([&](NodeBase* node) {
+      const value_type& candidate = value(node);
+      if (Less ? candidate < best : best < candidate) best = candidate;
+      return false;
+    });
   }
+  return best;
+}
 
-  Node* current = head;
-  while (current != nullptr && current->next != nullptr) {
-    if (current->data == current->next->data) {
-      Node* duplicate = current->next;
-      current->next = duplicate->next;
-      if (duplicate->next) {
-        duplicate->next->prev = current;
-      } else {
-        tail = current;
+// With a prefetch distance D, a second pointer runs D nodes ahead of the
+// visited one and prefetches every cache line of the node it reaches.
+template <typename T, typename Allocator, typename Stats>
+template <typename Visit>
+typename list<T, Allocator, Stats>::NodeBase* list<T, Allocator, Stats>::scan(
+    Visit&& visit) const {
+  NodeBase* end = const_cast<NodeBase*>(&sentinel_);
+  NodeBase* ahead = sentinel_.next;
+  if constexpr (kPrefetchDistance > 0) {
+    for (size_type i = 0; i < kPrefetchDistance && ahead != end; i++) {
+      detail::prefetch<sizeof(Node)>(ahead);
+      ahead = ahead->next;
+    }
+  }
+  NodeBase* current = sentinel_.next;
+  size_type visited = 0;
+  for (; current != end; current = current->next) {
+    if constexpr (kPrefetchDistance > 0) {
+      if (ahead != end) {
+        detail::prefetch<sizeof(Node)>(ahead);
+        ahead = ahead->next;
       }
-      delete duplicate;
-      list_size--;
-    } else {
-      current = current->next;
     }
+    visited++;
+    if (visit(current)) break;
   }
+  Stats::on_visit(visited);
+  return current;
 }
 
-template <typename T>
-void list<T>::sort() {
-  // Oleg
-  iterator iter = begin();
-  iterator iter2 = begin();
-  iter2++;
-  while (iter2.n_current != nullptr) {
-    if (iter2.n_current->data >= iter.n_current->data) {
-      iter++;
-      iter2++;
+template <typename T, typename Allocator, typename Stats>
+template <typename Item, typename F>
+void list<T, Allocator, Stats>::batch(size_type n, F& f) const {
+  n = std::min(std::max<size_type>(n, 1), kMaxBatch);
+  Item* items[kMaxBatch];
+  size_type count = 0;
+  scan([&](NodeBase* node) {
+    items[count++] = &value(node);
+    if (count == n) {
+      f(static_cast<Item* const*>(items), count);
+      count = 0;
+    }
+    return false;
+  });
+  if (count) f(static_cast<Item* const*>(items), count);
+}
+
+// A list that is the only user of its node pool moves into a fresh pool
+// with one chunk for all of its nodes, back to back in list order.
+// Otherwise, for nothrow-movable T, the values are permuted across the
+// existing nodes sorted by address; other T are moved (or copied) into new
+// nodes.
+template <typename T, typename Allocator, typename Stats>
+bool list<T, Allocator, Stats>::compact_if_needed() {
+  if constexpr (detail::has_compact_hint<node_allocator>::value) {
+    if (node_alloc().wants_compact(list_size)) {
+      compact();
+      return true;
+    }
+  }
+  return false;
+}
+
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::compact() {
+  bool relocated = list_size < 2;
+  if constexpr (detail::has_bulk_release<node_allocator>::value) {
+    if (!relocated && node_alloc().exclusive()) {
+      node_allocator fresh =
+          node_traits::select_on_container_copy_construction(node_alloc());
+      if constexpr (detail::has_reserve<node_allocator>::value) {
+        fresh.reserve(list_size);
+      }
+      relocate_nodes(fresh);
+      relocated = true;
+    }
+  }
+  if (!relocated) {
+    if constexpr (std::is_nothrow_move_constructible_v<value_type> &&
+                  std::is_nothrow_move_assignable_v<value_type>) {
+      order_by_address();
     } else {
-      insert(iter, iter2.n_current->data);
-      erase(iter2);
-      iter = begin();
-      iter2 = begin();
-      iter2++;
+      Chain chain = moved_chain();
+      destroy_nodes();
+      link_chain(&sentinel_, chain);
     }
   }
+  if constexpr (detail::has_compact_hint<node_allocator>::value) {
+    node_alloc().compacted();
+  }
 }
 
-template <typename T>
-typename list<T>::Node* list<T>::merge(Node* left, Node* right) {
-  if (!left) return right;
-  if (!right) return left;
-
-  if (left->data < right->data) {
-    left->next = merge(left->next, right);
-    left->next->prev = left;
-    left->prev = nullptr;
-    return left;
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::sort() {
+  sort(std::less<value_type>());
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename Compare>
+void list<T, Allocator, Stats>::sort(Compare comp) {
+  std::uint64_t comparisons = 0;
+  auto less = by_value(comp, comparisons);
+  detail::sort_ring(&sentinel_, less);
+  Stats::on_compare(comparisons);
+}
+
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::sort(const execution::parallel_policy& policy) {
+  sort(policy, std::less<value_type>());
+}
+
+// Cuts the list into one run per thread, sorts the runs concurrently and
+// merges neighbouring runs pairwise, in parallel, until one is left. Only
+// links are touched, so comp must be safe to call from several threads.
+template <typename T, typename Allocator, typename Stats>
+template <typename Compare>
+void list<T, Allocator, Stats>::sort(const execution::parallel_policy& policy,
+                                     Compare comp) {
+  size_type threads =
+      policy.threads ? policy.threads : std::thread::hardware_concurrency();
+  threads = std::min(threads, list_size / kParallelSortGrain);
+  if (threads < 2) {
+    sort(comp);
+    return;
+  }
+
+  std::vector<NodeBase*> runs(threads);
+  NodeBase* current = sentinel_.next;
+  for (size_type i = 0; i < threads; i++) {
+    size_type length = list_size / threads + (i < list_size % threads);
+    runs[i] = current;
+    for (size_type j = 1; j < length; j++) current = current->next;
+    NodeBase* next = current->next;
+    current->next = nullptr;
+    current = next;
+  }
+  Stats::on_visit(list_size);
+
+  std::atomic<std::uint64_t> comparisons{0};
+  detail::parallel_for(runs.size(), [&runs, &comp, &comparisons](size_type i) {
+    Compare local = comp;
+    std::uint64_t calls = 0;
+    auto less = by_value(local, calls);
+    runs[i] = detail::sort_chain(runs[i], less);
+    comparisons += calls;
+  });
+  // The left run wins ties, which keeps the result stable
+  while (runs.size() > 1) {
+    std::vector<NodeBase*> merged((runs.size() + 1) / 2);
+    auto merge_pair = [&runs, &merged, &comp, &comparisons](size_type i) {
+      Compare local = comp;
+      std::uint64_t calls = 0;
+      auto less = by_value(local, calls);
+      merged[i] =
+          2 * i + 1 < runs.size()
+              ? detail::merge_chains(runs[2 * i], runs[2 * i + 1], less)
+              : runs[2 * i];
+      comparisons += calls;
+    };
+    detail::parallel_for(merged.size(), merge_pair);
+    runs.swap(merged);
+  }
+  detail::adopt_chain(&sentinel_, runs.front());
+  Stats::on_compare(comparisons);
+}
+
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::save(std::ostream& os) const {
+  static_assert(std::is_trivially_copyable_v<value_type>,
+                "save needs a trivially copyable value_type");
+  auto header = detail::list_file_header::make(sizeof(value_type), list_size);
+  os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  // Values are gathered into blocks so that each write() call is large
+  std::vector<unsigned char> block(kLoadBlock * sizeof(value_type));
+  size_type filled = 0;
+  for (NodeBase* it = sentinel_.next; it != &sentinel_; it = it->next) {
+    std::memcpy(block.data() + filled * sizeof(value_type), &value(it),
+                sizeof(value_type));
+    if (++filled == kLoadBlock || it->next == &sentinel_) {
+      os.write(reinterpret_cast<const char*>(block.data()),
+               static_cast<std::streamsize>(filled * sizeof(value_type)));
+      filled = 0;
+    }
+  }
+  if (!os) throw "io_error";
+}
+
+// Reads the values in blocks into raw storage and builds the new chain from
+// it before the old nodes are dropped
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::load(std::istream& is) {
+  static_assert(std::is_trivially_copyable_v<value_type>,
+                "load needs a trivially copyable value_type");
+  detail::list_file_header header;
+  if (!is.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+    throw "bad_format";
+  }
+  header.validate(sizeof(value_type));
+
+  std::allocator<value_type> staging_alloc;
+  value_type* staging = staging_alloc.allocate(kLoadBlock);
+  Chain chain;
+  try {
+    for (std::uint64_t left = header.count; left;) {
+      size_type n = left < kLoadBlock ? left : kLoadBlock;
+      if (!is.read(reinterpret_cast<char*>(staging),
+                   static_cast<std::streamsize>(n * sizeof(value_type)))) {
+        throw "bad_format";
+      }
+      chain_append_raw(chain, reinterpret_cast<unsigned char*>(staging), n);
+      left -= n;
+    }
+  } catch (...) {
+    destroy_chain(chain);
+    staging_alloc.deallocate(staging, kLoadBlock);
+    throw;
+  }
+  staging_alloc.deallocate(staging, kLoadBlock);
+  destroy_nodes();
+  link_chain(&sentinel_, chain);
+}
+
+// Builds the nodes straight from the mapped payload, without read() calls
+// or a staging copy
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::load_mapped(const std::string& path) {
+  static_assert(std::is_trivially_copyable_v<value_type>,
+                "load_mapped needs a trivially copyable value_type");
+  detail::mapped_file file(path);
+  detail::list_file_header header;
+  if (file.size() < sizeof(header)) throw "bad_format";
+  std::memcpy(&header, file.data(), sizeof(header));
+  header.validate(sizeof(value_type));
+  if ((file.size() - sizeof(header)) / sizeof(value_type) < header.count) {
+    throw "bad_format";
+  }
+
+  Chain chain;
+  try {
+    chain_append_raw(chain, file.data() + sizeof(header), header.count);
+  } catch (...) {
+    destroy_chain(chain);
+    throw;
+  }
+  destroy_nodes();
+  link_chain(&sentinel_, chain);
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <class... Args>
+typename list<T, Allocator, Stats>::Node*
+list<T, Allocator, Stats>::create_node(Args&&... args) {
+  Node* node = node_traits::allocate(node_alloc(), 1);
+  try {
+    node_traits::construct(node_alloc(), node,
+                           std::forward<Args>(args)...);
+  } catch (...) {
+    node_traits::deallocate(node_alloc(), node, 1);
+    throw;
+  }
+  Stats::on_allocate();
+  return node;
+}
+
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::destroy_node(NodeBase* node) {
+  Node* tmp = static_cast<Node*>(node);
+  node_traits::destroy(node_alloc(), tmp);
+  node_traits::deallocate(node_alloc(), tmp, 1);
+  Stats::on_free(1);
+}
+
+// n nodes constructed from args; on failure nothing is left allocated
+template <typename T, typename Allocator, typename Stats>
+template <class... Args>
+typename list<T, Allocator, Stats>::Chain list<T, Allocator, Stats>::make_chain(
+    size_type n, const Args&... args) {
+  Chain chain;
+  try {
+    for (size_type i = 0; i < n; i++) chain_append(chain, args...);
+  } catch (...) {
+    destroy_chain(chain);
+    throw;
+  }
+  return chain;
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename InputIt>
+typename list<T, Allocator, Stats>::Chain list<T, Allocator, Stats>::make_chain(
+    InputIt first, InputIt last) {
+  Chain chain;
+  try {
+    for (; first != last; ++first) chain_append(chain, *first);
+  } catch (...) {
+    destroy_chain(chain);
+    throw;
+  }
+  return chain;
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <class... Args>
+void list<T, Allocator, Stats>::chain_append(Chain& chain, Args&&... args) {
+  Node* node = create_node(std::forward<Args>(args)...);
+  node->prev = chain.tail;
+  if (chain.tail) {
+    chain.tail->next = node;
   } else {
-    right->next = merge(left, right->next);
-    right->next->prev = right;
-    right->prev = nullptr;
-    return right;
+    chain.head = node;
   }
+  chain.tail = node;
+  chain.size++;
 }
 
-template <typename T>
+// Appends count values stored back to back at data, which need not be
+// aligned for value_type
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::chain_append_raw(Chain& chain,
+                                                 const unsigned char* data,
+                                                 size_type count) {
+  if (reinterpret_cast<std::uintptr_t>(data) % alignof(value_type) == 0) {
+    const value_type* values = reinterpret_cast<const value_type*>(data);
+    for (size_type i = 0; i < count; i++) chain_append(chain, values[i]);
+    return;
+  }
+  alignas(value_type) unsigned char slot[sizeof(value_type)];
+  for (size_type i = 0; i < count; i++) {
+    std::memcpy(slot, data + i * sizeof(value_type), sizeof(value_type));
+    chain_append(chain, *reinterpret_cast<const value_type*>(slot));
+  }
+}
+
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::destroy_chain(Chain& chain) {
+  NodeBase* current = chain.head;
+  for (size_type i = 0; i < chain.size; i++) {
+    NodeBase* next = current->next;
+    destroy_node(current);
+    current = next;
+  }
+  chain = Chain();
+}
+
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::unlink_to(Chain& removed, NodeBase* node) {
+  detail::unlink_range(node, node);
+  node->next = removed.head;
+  removed.head = node;
+  removed.size++;
+  list_size--;
+}
+
+// Links the whole chain before pos and returns its first element (or pos)
+template <typename T, typename Allocator, typename Stats>
+typename list<T, Allocator, Stats>::iterator
+list<T, Allocator, Stats>::link_chain(NodeBase* pos, Chain& chain) {
+  if (!chain.size) return iterator(pos);
+  detail::link_range(pos, chain.head, chain.tail);
+  list_size += chain.size;
+  Stats::on_size(list_size);
+  NodeBase* head = chain.head;
+  chain = Chain();
+  return iterator(head);
+}
+
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::reset_sentinel() {
+  sentinel_.next = sentinel_.prev = &sentinel_;
+  list_size = 0;
+}
+
+// Points the end nodes back at this sentinel after it was copied or swapped
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::adopt_sentinel() {
+  if (list_size == 0) {
+    sentinel_.next = sentinel_.prev = &sentinel_;
+  } else {
+    sentinel_.next->prev = sentinel_.prev->next = &sentinel_;
+  }
+}
+
+// Takes over the nodes of other; the allocators must compare equal.
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::steal_nodes(list& other) {
+  sentinel_ = other.sentinel_;
+  list_size = other.list_size;
+  Stats::on_size(list_size);
+  adopt_sentinel();
+  other.reset_sentinel();
+}
+
+// Moves count nodes [first, last] of other before pos by relinking. Nodes
+// cannot change hands between unequal allocators, then the values are moved.
+template <typename T, typename Allocator, typename Stats>
+void list<T, Allocator, Stats>::transfer(NodeBase* pos, list& other,
+                                         NodeBase* first, NodeBase* last,
+                                         size_type count) {
+  if (&other == this && (pos == first || pos == last->next)) return;
+  if (node_alloc() == other.node_alloc()) {
+    detail::unlink_range(first, last);
+    other.list_size -= count;
+    detail::link_range(pos, first, last);
+    list_size += count;
+    Stats::on_size(list_size);
+  } else {
+    NodeBase* stop = last->next;
+    while (first != stop) {
+      NodeBase* next = first->next;
+      emplace(iterator(pos), std::move(value(first)));
+      other.erase_node(first);
+      first = next;
+    }
+  }
+}
+
+template <typename T, typename Allocator, typename Stats>
 template <class... Args>
-typename list<T>::ListIterator list<T>::emplace(const_iterator pos,
-                                                Args&&... args) {
-  return insert(pos, T(args...));
+typename list<T, Allocator, Stats>::ListIterator
+list<T, Allocator, Stats>::emplace(const_iterator pos, Args&&... args) {
+  Node* newNode = create_node(std::forward<Args>(args)...);
+  detail::link_range(pos.n_current, newNode, newNode);
+  list_size++;
+  Stats::on_size(list_size);
+  return iterator(newNode);
 }
 
-template <typename T>
+template <typename T, typename Allocator, typename Stats>
 template <class... Args>
-void list<T>::emplace_back(Args&&... args) {
-  push_back(T(args...));
+void list<T, Allocator, Stats>::emplace_back(Args&&... args) {
+  emplace(end(), std::forward<Args>(args)...);
 }
 
-template <typename T>
+template <typename T, typename Allocator, typename Stats>
 template <class... Args>
-void list<T>::emplace_front(Args&&... args) {
-  push_front(T(args...));
+void list<T, Allocator, Stats>::emplace_front(Args&&... args) {
+  emplace(begin(), std::forward<Args>(args)...);
 }
 
+namespace pmr {
+// A list whose memory resource is chosen per object at run time, e.g.
+// s21::pmr::list<int> list(&resource). Lists on different resources swap
+// and move-assign by moving their values.
+template <typename T, typename Stats = no_stats>
+using list = s21::list<T, std::pmr::polymorphic_allocator<T>, Stats>;
+}  // namespace pmr
+
 }  // namespace s21
 #endif
@@ -0,0 +1,166 @@
+#ifndef S21_LIST_HOOK_H
+#define S21_LIST_HOOK_H
+
+#include <cstddef>
+#include <utility>
+
+namespace s21 {
+
+// Links of one element of a doubly linked ring. s21::list embeds them in the
+// nodes it allocates, s21::intrusive_list expects them as a member of T.
+struct list_hook {
+  list_hook* next = nullptr;
+  list_hook* prev = nullptr;
+};
+
+namespace detail {
+
+// Algorithms shared by list and intrusive_list. Each list is a ring closed by
+// a sentinel hook; a chain is a run of hooks linked by next and terminated by
+// nullptr. less(a, b) compares the elements behind two hooks.
+
+// Detaches [first, last] from its ring, the ends keep their old links
+constexpr void unlink_range(list_hook* first, list_hook* last) {
+  first->prev->next = last->next;
+  last->next->prev = first->prev;
+}
+
+// Links the detached range [first, last] before pos
+constexpr void link_range(list_hook* pos, list_hook* first, list_hook* last) {
+  list_hook* before = pos->prev;
+  first->prev = before;
+  last->next = pos;
+  before->next = first;
+  pos->prev = last;
+}
+
+// Swapping the links of every hook, sentinel included, also swaps head and
+// tail
+inline void reverse_ring(list_hook* sentinel) {
+  list_hook* current = sentinel;
+  do {
+    std::swap(current->next, current->prev);
+    current = current->prev;
+  } while (current != sentinel);
+}
+
+// Hangs a chain off the sentinel and restores the prev links
+inline void adopt_chain(list_hook* sentinel, list_hook* head) {
+  list_hook* current = sentinel;
+  current->next = head;
+  while (current->next) {
+    current->next->prev = current;
+    current = current->next;
+  }
+  current->next = sentinel;
+  sentinel->prev = current;
+}
+
+// Merges two sorted chains by next links. On equal keys the hook from left
+// wins, which keeps the sort stable.
+template <typename Less>
+list_hook* merge_chains(list_hook* left, list_hook* right, Less& less) {
+  list_hook* result = nullptr;
+  list_hook** link = &result;
+  while (left && right) {
+    if (less(right, left)) {
+      *link = right;
+      right = right->next;
+    } else {
+      *link = left;
+      left = left->next;
+    }
+    link = &(*link)->next;
+  }
+  *link = left ? left : right;
+  return result;
+}
+
+// Bottom-up merge sort: bins[i] holds a sorted run of 2^i hooks (or nullptr)
+template <typename Less>
+list_hook* sort_chain(list_hook* head, Less& less) {
+  list_hook* bins[64] = {};
+  list_hook* rest = head;
+  while (rest) {
+    list_hook* run = rest;
+    rest = rest->next;
+    run->next = nullptr;
+    std::size_t i = 0;
+    for (; bins[i]; ++i) {
+      run = merge_chains(bins[i], run, less);
+      bins[i] = nullptr;
+    }
+    bins[i] = run;
+  }
+
+  list_hook* result = nullptr;
+  for (list_hook* bin : bins) {
+    if (bin) result = result ? merge_chains(bin, result, less) : bin;
+  }
+  return result;
+}
+
+// Sorts the whole ring, relinking only
+template <typename Less>
+void sort_ring(list_hook* sentinel, Less& less) {
+  if (sentinel->next == sentinel->prev) return;
+  sentinel->prev->next = nullptr;
+  adopt_chain(sentinel, sort_chain(sentinel->next, less));
+}
+
+// Moves every hook of the sorted ring from into the sorted ring into and
+// adds the sizes. The merged chain grows from a link-only head on the stack;
+// whatever is left of either ring is already linked and ends at its known
+// tail. If less throws, every hook still ends up in into.
+template <typename Less>
+void merge_rings(list_hook* into, std::size_t& into_size, list_hook* from,
+                 std::size_t& from_size, Less& less) {
+  if (into == from || from->next == from) return;
+  list_hook head;
+  list_hook* tail = &head;
+  list_hook* first = into->next;
+  list_hook* second = from->next;
+
+  auto finish = [&]() {
+    if (first != into) {
+      tail->next = first;
+      first->prev = tail;
+      tail = into->prev;
+    }
+    if (second != from) {
+      tail->next = second;
+      second->prev = tail;
+      tail = from->prev;
+    }
+    into->next = head.next;
+    into->next->prev = into;
+    into->prev = tail;
+    tail->next = into;
+    from->next = from->prev = from;
+    into_size += from_size;
+    from_size = 0;
+  };
+
+  try {
+    while (first != into && second != from) {
+      if (less(second, first)) {
+        tail->next = second;
+        second->prev = tail;
+        second = second->next;
+      } else {
+        tail->next = first;
+        first->prev = tail;
+        first = first->next;
+      }
+      tail = tail->next;
+    }
+  } catch (...) {
+    finish();
+    throw;
+  }
+  finish();
+}
+
+}  // namespace detail
+}  // namespace s21
+#endif
@@ -0,0 +1,113 @@
+#ifndef S21_LIST_IO_H
+#define S21_LIST_IO_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define S21_LIST_HAS_MMAP 1
+#endif
+
+namespace s21 {
+namespace detail {
+
+// On-disk layout of list::save: this header, then count values of
+// value_size bytes each, copied as they are in memory. The header is 32 bytes
+// so the payload of a mapped file stays aligned for most value types.
+struct list_file_header {
+  static constexpr char kMagic[4] = {'S', '2', '1', 'L'};
+  static constexpr std::uint32_t kVersion = 1;
+  static constexpr std::uint32_t kByteOrder = 0x01020304;
+
+  char magic[4];
+  std::uint32_t version;
+  std::uint32_t byte_order;
+  std::uint32_t value_size;
+  std::uint64_t count;
+  std::uint64_t reserved;
+
+  static list_file_header make(std::size_t value_size, std::uint64_t count) {
+    list_file_header header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.byte_order = kByteOrder;
+    header.value_size = static_cast<std::uint32_t>(value_size);
+    header.count = count;
+    return header;
+  }
+
+  // Files of another version, byte order or value type are rejected
+  void validate(std::size_t expected_value_size) const {
+    if (std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 ||
+        version != kVersion || byte_order != kByteOrder ||
+        value_size != expected_value_size) {
+      throw "bad_format";
+    }
+  }
+};
+static_assert(sizeof(list_file_header) == 32, "file header must not pad");
+
+// Read-only view of a whole file: mmap where available, otherwise the file
+// is read into memory.
+class mapped_file {
+ public:
+  explicit mapped_file(const std::string& path) {
+#ifdef S21_LIST_HAS_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw "io_error";
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+      ::close(fd);
+      throw "io_error";
+    }
+    size_ = static_cast<std::size_t>(info.st_size);
+    if (size_) {
+      void* data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data == MAP_FAILED) {
+        ::close(fd);
+        throw "io_error";
+      }
+      ::madvise(data, size_, MADV_SEQUENTIAL);
+      data_ = static_cast<const unsigned char*>(data);
+    }
+    ::close(fd);
+#else
+    std::ifstream file(path, std::ios::binary);
+    if (!file) throw "io_error";
+    copy_.assign(std::istreambuf_iterator<char>(file),
+                 std::istreambuf_iterator<char>());
+    data_ = reinterpret_cast<const unsigned char*>(copy_.data());
+    size_ = copy_.size();
+#endif
+  }
+  mapped_file(const mapped_file&) = delete;
+  mapped_file& operator=(const mapped_file&) = delete;
+  ~mapped_file() {
+#ifdef S21_LIST_HAS_MMAP
+    if (data_) ::munmap(const_cast<unsigned char*>(data_), size_);
+#endif
+  }
+
+  const unsigned char* data() const noexcept { return data_; }
+  std::size_t size() const noexcept { return size_; }
+
+ private:
+  const unsigned char* data_ = nullptr;
+  std::size_t size_ = 0;
+#ifndef S21_LIST_HAS_MMAP
+  std::vector<char> copy_;
+#endif
+};
+
+}  // namespace detail
+}  // namespace s21
+#endif
@@ -0,0 +1,224 @@
+#ifndef S21_LIST_SIMD_H
+#define S21_LIST_SIMD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// GCC-style vector extensions compile to SSE2 on x86-64 (and NEON on ARM);
+// on x86 an AVX2 build of every kernel is picked at run time when the CPU
+// has it. Other compilers use the scalar loops.
+#if defined(__GNUC__)
+#define S21_LIST_HAS_VECTOR 1
+#if defined(__x86_64__) || defined(__i386__)
+#define S21_LIST_HAS_AVX2 1
+#endif
+#endif
+
+namespace s21 {
+namespace detail {
+
+// Element types the list compares with the kernels below
+template <typename T>
+inline constexpr bool is_simd_value =
+    std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+    !std::is_same_v<T, long double>;
+
+// Kernels over n values the list has copied out of its nodes into one
+// buffer. Every vector kernel falls back to these for the last n % lanes.
+template <typename T>
+std::size_t scalar_find(const T* values, std::size_t n, T x) {
+  for (std::size_t i = 0; i < n; i++) {
+    if (values[i] == x) return i;
+  }
+  return n;
+}
+
+template <typename T>
+std::size_t scalar_count(const T* values, std::size_t n, T x) {
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < n; i++) count += values[i] == x;
+  return count;
+}
+
+template <typename T>
+bool scalar_equal(const T* a, const T* b, std::size_t n) {
+  for (std::size_t i = 0; i < n; i++) {
+    if (!(a[i] == b[i])) return false;
+  }
+  return true;
+}
+
+// Least (Less) or greatest value of init and values[0, n)
+template <bool Less, typename T>
+T scalar_extreme(const T* values, std::size_t n, T init) {
+  for (std::size_t i = 0; i < n; i++) {
+    if (Less ? values[i] < init : init < values[i]) init = values[i];
+  }
+  return init;
+}
+
+#ifdef S21_LIST_HAS_VECTOR
+#define S21_LIST_KERNEL static inline __attribute__((always_inline))
+// The helpers pass 32-byte vectors by value but are always inlined, so the
+// ABI GCC warns about never applies
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+// The same kernels on Bytes-wide vectors. n is one block of the list, small
+// enough for the per-lane match counters of count() not to wrap.
+template <std::size_t Bytes, typename T>
+struct vector_kernels {
+  typedef T vec __attribute__((vector_size(Bytes)));
+  using mask = decltype(vec() == vec());
+  static constexpr std::size_t kLanes = Bytes / sizeof(T);
+
+  S21_LIST_KERNEL vec load(const T* values) {
+    vec v;
+    std::memcpy(&v, values, sizeof(v));
+    return v;
+  }
+  S21_LIST_KERNEL vec splat(T x) {
+    vec v;
+    for (std::size_t lane = 0; lane < kLanes; lane++) v[lane] = x;
+    return v;
+  }
+  S21_LIST_KERNEL bool any(const mask& m) {
+    std::uint64_t words[Bytes / 8];
+    std::memcpy(words, &m, sizeof(m));
+    std::uint64_t bits = 0;
+    for (std::uint64_t word : words) bits |= word;
+    return bits != 0;
+  }
+
+  S21_LIST_KERNEL std::size_t find(const T* values, std::size_t n, T x) {
+    const vec key = splat(x);
+    std::size_t i = 0;
+    for (; i + kLanes <= n; i += kLanes) {
+      if (any(load(values + i) == key)) break;
+    }
+    return i + scalar_find(values + i, n - i, x);
+  }
+
+  S21_LIST_KERNEL std::size_t count(const T* values, std::size_t n, T x) {
+    const vec key = splat(x);
+    mask matches = mask();
+    std::size_t i = 0;
+    for (; i + kLanes <= n; i += kLanes) matches -= load(values + i) == key;
+    std::size_t count = 0;
+    for (std::size_t lane = 0; lane < kLanes; lane++) {
+      count += static_cast<std::size_t>(matches[lane]);
+    }
+    return count + scalar_count(values + i, n - i, x);
+  }
+
+  S21_LIST_KERNEL bool equal(const T* a, const T* b, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + kLanes <= n; i += kLanes) {
+      if (any(load(a + i) != load(b + i))) return false;
+    }
+    return scalar_equal(a + i, b + i, n - i);
+  }
+
+  template <bool Less>
+  S21_LIST_KERNEL T extreme(const T* values, std::size_t n, T init) {
+    vec best = splat(init);
+    std::size_t i = 0;
+    for (; i + kLanes <= n; i += kLanes) {
+      const vec v = load(values + i);
+      best = (Less ? v < best : best < v) ? v : best;
+    }
+    for (std::size_t lane = 0; lane < kLanes; lane++) {
+      const T value = best[lane];
+      init = scalar_extreme<Less>(&value, 1, init);
+    }
+    return scalar_extreme<Less>(values + i, n - i, init);
+  }
+};
+#pragma GCC diagnostic pop
+#undef S21_LIST_KERNEL
+#endif
+
+#ifdef S21_LIST_HAS_AVX2
+#define S21_LIST_AVX2 __attribute__((target("avx2")))
+
+template <typename T>
+S21_LIST_AVX2 std::size_t avx2_find(const T* values, std::size_t n, T x) {
+  return vector_kernels<32, T>::find(values, n, x);
+}
+template <typename T>
+S21_LIST_AVX2 std::size_t avx2_count(const T* values, std::size_t n, T x) {
+  return vector_kernels<32, T>::count(values, n, x);
+}
+template <typename T>
+S21_LIST_AVX2 bool avx2_equal(const T* a, const T* b, std::size_t n) {
+  return vector_kernels<32, T>::equal(a, b, n);
+}
+template <bool Less, typename T>
+S21_LIST_AVX2 T avx2_extreme(const T* values, std::size_t n, T init) {
+  return vector_kernels<32, T>::template extreme<Less>(values, n, init);
+}
+#undef S21_LIST_AVX2
+
+inline bool cpu_has_avx2() {
+  static const bool has_avx2 = [] {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+  }();
+  return has_avx2;
+}
+#endif
+
+// Entry points: AVX2 if the CPU has it, else 16-byte vectors, else scalar
+template <typename T>
+std::size_t simd_find(const T* values, std::size_t n, T x) {
+#ifdef S21_LIST_HAS_AVX2
+  if (cpu_has_avx2()) return avx2_find(values, n, x);
+#endif
+#ifdef S21_LIST_HAS_VECTOR
+  return vector_kernels<16, T>::find(values, n, x);
+#else
+  return scalar_find(values, n, x);
+#endif
+}
+
+template <typename T>
+std::size_t simd_count(const T* values, std::size_t n, T x) {
+#ifdef S21_LIST_HAS_AVX2
+  if (cpu_has_avx2()) return avx2_count(values, n, x);
+#endif
+#ifdef S21_LIST_HAS_VECTOR
+  return vector_kernels<16, T>::count(values, n, x);
+#else
+  return scalar_count(values, n, x);
+#endif
+}
+
+template <typename T>
+bool simd_equal(const T* a, const T* b, std::size_t n) {
+#ifdef S21_LIST_HAS_AVX2
+  if (cpu_has_avx2()) return avx2_equal(a, b, n);
+#endif
+#ifdef S21_LIST_HAS_VECTOR
+  return vector_kernels<16, T>::equal(a, b, n);
+#else
+  return scalar_equal(a, b, n);
+#endif
+}
+
+template <bool Less, typename T>
+T simd_extreme(const T* values, std::size_t n, T init) {
+#ifdef S21_LIST_HAS_AVX2
+  if (cpu_has_avx2()) return avx2_extreme<Less>(values, n, init);
+#endif
+#ifdef S21_LIST_HAS_VECTOR
+  return vector_kernels<16, T>::template extreme<Less>(values, n, init);
+#else
+  return scalar_extreme<Less>(values, n, init);
+#endif
+}
+
+}  // namespace detail
+}  // namespace s21
+#endif
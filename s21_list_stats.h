@@ -0,0 +1,66 @@
+#ifndef S21_LIST_STATS_H
+#define S21_LIST_STATS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace s21 {
+
+// Operation counters of one list. Node visits are the nodes walked by the
+// list's own loops (clear, unique, remove, dedupe, assign, range splice) and
+// by its const scans (for_each, accumulate, find, count, min, max and the
+// like); walks through iterators are not counted.
+struct list_stats {
+  std::uint64_t allocations = 0;
+  std::uint64_t frees = 0;
+  std::uint64_t node_visits = 0;
+  std::uint64_t comparisons = 0;  // sort, merge, unique, dedupe
+  std::size_t peak_size = 0;
+
+  std::string to_json() const {
+    return "{\"allocations\":" + std::to_string(allocations) +
+           ",\"frees\":" + std::to_string(frees) +
+           ",\"node_visits\":" + std::to_string(node_visits) +
+           ",\"comparisons\":" + std::to_string(comparisons) +
+           ",\"peak_size\":" + std::to_string(peak_size) + "}";
+  }
+};
+
+// Stats policies for the third template parameter of s21::list. The list
+// derives from its policy, so the empty default costs neither space nor
+// time; counting_stats adds one list_stats per list.
+struct no_stats {
+  static constexpr bool enabled = false;
+
+  void on_allocate() noexcept {}
+  void on_free(std::size_t) noexcept {}
+  void on_visit(std::size_t) const noexcept {}
+  void on_compare(std::uint64_t) noexcept {}
+  void on_size(std::size_t) noexcept {}
+
+  list_stats stats() const noexcept { return {}; }
+  void reset_stats() noexcept {}
+};
+
+struct counting_stats {
+  static constexpr bool enabled = true;
+
+  void on_allocate() noexcept { stats_.allocations++; }
+  void on_free(std::size_t n) noexcept { stats_.frees += n; }
+  // const: the list's const scans count their visits too
+  void on_visit(std::size_t n) const noexcept { stats_.node_visits += n; }
+  void on_compare(std::uint64_t n) noexcept { stats_.comparisons += n; }
+  void on_size(std::size_t size) noexcept {
+    if (size > stats_.peak_size) stats_.peak_size = size;
+  }
+
+  list_stats stats() const noexcept { return stats_; }
+  void reset_stats() noexcept { stats_ = list_stats(); }
+
+ private:
+  mutable list_stats stats_;
+};
+
+}  // namespace s21
+#endif
@@ -0,0 +1,194 @@
+#ifndef S21_NODE_POOL_H
+#define S21_NODE_POOL_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace s21 {
+
+// Slab of fixed-size blocks with a free list. Blocks are carved out of
+// cache-line-aligned chunks that double in size up to kMaxChunkBlocks; erased
+// blocks go back to the free list and are reused before the chunk grows.
+class node_pool {
+ public:
+  static constexpr std::size_t kChunkAlign = 64;
+  static constexpr std::size_t kMinChunkBlocks = 32;
+  static constexpr std::size_t kMaxChunkBlocks = 4096;
+
+  node_pool() = default;
+  node_pool(const node_pool&) = delete;
+  node_pool& operator=(const node_pool&) = delete;
+  ~node_pool() { release(); }
+
+  // Block size is fixed by the first request; other sizes are not served.
+  bool serves(std::size_t size, std::size_t align) const noexcept {
+    return align <= kChunkAlign &&
+           (block_size_ == 0 || block_size_ == round_up(size, align));
+  }
+
+  void* allocate(std::size_t size, std::size_t align) {
+    if (block_size_ == 0) block_size_ = round_up(size, align);
+    if (free_) {
+      FreeBlock* block = free_;
+      free_ = block->next;
+      reused_++;
+      return block;
+    }
+    if (cursor_ == end_) grow();
+    void* block = cursor_;
+    cursor_ += block_size_;
+    return block;
+  }
+
+  void deallocate(void* block) noexcept {
+    FreeBlock* free_block = static_cast<FreeBlock*>(block);
+    free_block->next = free_;
+    free_ = free_block;
+  }
+
+  // Makes the next chunk hold at least blocks blocks, so that many fresh
+  // allocations come back to back from one chunk
+  void reserve(std::size_t blocks) noexcept {
+    if (blocks > next_blocks_) next_blocks_ = blocks;
+  }
+
+  // Blocks handed out again from the free list since the last compaction.
+  // Each one lands wherever an erased node used to be, so the count grows
+  // with how far the lists of this pool have drifted from address order.
+  std::size_t reused() const noexcept { return reused_; }
+  void compacted() noexcept { reused_ = 0; }
+
+  // Ratio of reused blocks to live nodes past which list::compact_if_needed
+  // compacts, 0 (the default) never asks for it
+  double compact_ratio() const noexcept { return compact_ratio_; }
+  void set_compact_ratio(double ratio) noexcept { compact_ratio_ = ratio; }
+
+  // Returns every chunk at once, O(chunks). Outstanding blocks become invalid.
+  void release() noexcept {
+    while (chunks_) {
+      Chunk* next = chunks_->next;
+      ::operator delete(chunks_, std::align_val_t(kChunkAlign));
+      chunks_ = next;
+    }
+    free_ = nullptr;
+    cursor_ = end_ = nullptr;
+    next_blocks_ = kMinChunkBlocks;
+    reused_ = 0;
+  }
+
+ private:
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+  struct alignas(kChunkAlign) Chunk {
+    Chunk* next;
+  };
+
+  static std::size_t round_up(std::size_t size, std::size_t align) noexcept {
+    if (size < sizeof(FreeBlock)) size = sizeof(FreeBlock);
+    if (align < alignof(FreeBlock)) align = alignof(FreeBlock);
+    return (size + align - 1) / align * align;
+  }
+
+  void grow() {
+    std::size_t bytes = sizeof(Chunk) + next_blocks_ * block_size_;
+    Chunk* chunk = static_cast<Chunk*>(
+        ::operator new(bytes, std::align_val_t(kChunkAlign)));
+    chunk->next = chunks_;
+    chunks_ = chunk;
+    cursor_ = reinterpret_cast<unsigned char*>(chunk + 1);
+    end_ = cursor_ + next_blocks_ * block_size_;
+    if (next_blocks_ < kMaxChunkBlocks) next_blocks_ *= 2;
+  }
+
+  Chunk* chunks_ = nullptr;
+  FreeBlock* free_ = nullptr;
+  unsigned char* cursor_ = nullptr;
+  unsigned char* end_ = nullptr;
+  std::size_t block_size_ = 0;
+  std::size_t next_blocks_ = kMinChunkBlocks;
+  std::size_t reused_ = 0;
+  double compact_ratio_ = 0;
+};
+
+// Standard-conforming allocator over a shared node_pool. Single-object
+// requests of the pool's block size are served from the pool, everything else
+// goes to std::allocator. Copies (and rebound copies) share the pool; a
+// container copy gets a fresh one.
+template <typename T>
+class node_pool_allocator {
+ public:
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::false_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  using is_always_equal = std::false_type;
+
+  node_pool_allocator() : pool_(std::make_shared<node_pool>()) {}
+  node_pool_allocator(const node_pool_allocator&) noexcept = default;
+  node_pool_allocator& operator=(const node_pool_allocator&) noexcept =
+      default;
+  template <typename U>
+  node_pool_allocator(const node_pool_allocator<U>& other) noexcept
+      : pool_(other.pool_) {}
+
+  T* allocate(std::size_t n) {
+    if (n == 1 && pool_->serves(sizeof(T), alignof(T))) {
+      return static_cast<T*>(pool_->allocate(sizeof(T), alignof(T)));
+    }
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T* p, std::size_t n) noexcept {
+    if (n == 1 && pool_->serves(sizeof(T), alignof(T))) {
+      pool_->deallocate(p);
+    } else {
+      std::allocator<T>().deallocate(p, n);
+    }
+  }
+
+  // A fresh pool with the same compaction setting
+  node_pool_allocator select_on_container_copy_construction() const {
+    node_pool_allocator copy;
+    copy.pool_->set_compact_ratio(pool_->compact_ratio());
+    return copy;
+  }
+
+  // Bulk release: valid only when no other allocator shares the pool.
+  bool exclusive() const noexcept { return pool_.use_count() == 1; }
+  void release_all() noexcept { pool_->release(); }
+  void reserve(std::size_t n) noexcept { pool_->reserve(n); }
+
+  // list::compact_if_needed compacts a list using this pool once more than
+  // ratio * size() of the pool's blocks were reused. Shared by every copy of
+  // the allocator; 0 turns it off.
+  void set_compact_ratio(double ratio) noexcept {
+    pool_->set_compact_ratio(ratio);
+  }
+  bool wants_compact(std::size_t live) const noexcept {
+    double ratio = pool_->compact_ratio();
+    return ratio > 0 && static_cast<double>(pool_->reused()) >
+                            ratio * static_cast<double>(live);
+  }
+  void compacted() noexcept { pool_->compacted(); }
+
+  template <typename U>
+  bool operator==(const node_pool_allocator<U>& other) const noexcept {
+    return pool_ == other.pool_;
+  }
+  template <typename U>
+  bool operator!=(const node_pool_allocator<U>& other) const noexcept {
+    return pool_ != other.pool_;
+  }
+
+ private:
+  template <typename U>
+  friend class node_pool_allocator;
+
+  std::shared_ptr<node_pool> pool_;
+};
+
+}  // namespace s21
+#endif
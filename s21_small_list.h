@@ -0,0 +1,557 @@
+#ifndef S21_SMALL_LIST_H
+#define S21_SMALL_LIST_H
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "s21_list_hook.h"
+
+// constexpr where C++20 allows it: the inline nodes are unions and spilled
+// nodes come from new, neither of which C++17 permits at compile time
+#if __cplusplus >= 202002L
+#define S21_CONSTEXPR20 constexpr
+#else
+#define S21_CONSTEXPR20 inline
+#endif
+
+namespace s21 {
+
+// list whose first N nodes live in an array inside the object. Nodes come
+// from that array while it has room and from the heap beyond it; erased
+// inline nodes are reused first. A list that never holds more than N
+// elements never allocates.
+//
+// Inline nodes cannot change owners, so moving, swapping, splicing and
+// merging move the values of inline nodes into nodes of the receiving list
+// (heap nodes are still relinked). They are O(n), and iterators into the
+// source are invalidated. In C++20 everything except sort is constexpr.
+template <typename T, std::size_t N = 16>
+class small_list {
+  static_assert(N >= 1, "small_list needs at least one inline node");
+
+ public:
+  // List Member Type
+  class ListIterator;
+  class ConstListIterator;
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+  using iterator = ListIterator;
+  using const_iterator = ConstListIterator;
+
+ private:
+  struct Node : list_hook {
+    S21_CONSTEXPR20 Node() : empty() {}
+    S21_CONSTEXPR20 ~Node() {}
+
+    union {
+      char empty;
+      T value;  // alive while the node is linked
+    };
+    bool on_heap = false;
+  };
+
+  list_hook sentinel_;
+  size_type list_size;
+  list_hook* free_;  // erased inline nodes, chained by next
+  size_type fresh_;  // inline nodes never handed out so far
+  Node inline_[N];
+
+  static constexpr Node* node(list_hook* hook) {
+    return static_cast<Node*>(hook);
+  }
+
+ public:
+  class ListIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    list_hook* n_current;
+
+    constexpr ListIterator() : n_current(nullptr) {}
+    constexpr explicit ListIterator(list_hook* hook) : n_current(hook) {}
+
+    constexpr reference operator*() const { return node(n_current)->value; }
+    constexpr pointer operator->() const { return &node(n_current)->value; }
+
+    constexpr ListIterator& operator++() {
+      n_current = n_current->next;
+      return *this;
+    }
+    constexpr ListIterator operator++(int) {
+      ListIterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+    constexpr ListIterator& operator--() {
+      n_current = n_current->prev;
+      return *this;
+    }
+    constexpr ListIterator operator--(int) {
+      ListIterator tmp = *this;
+      --(*this);
+      return tmp;
+    }
+
+    constexpr bool operator==(const ListIterator& other) const {
+      return n_current == other.n_current;
+    }
+    constexpr bool operator!=(const ListIterator& other) const {
+      return n_current != other.n_current;
+    }
+  };
+
+  class ConstListIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    list_hook* n_current;
+
+    constexpr ConstListIterator() : n_current(nullptr) {}
+    constexpr explicit ConstListIterator(list_hook* hook) : n_current(hook) {}
+    constexpr ConstListIterator(const ListIterator& it)
+        : n_current(it.n_current) {}
+
+    constexpr reference operator*() const { return node(n_current)->value; }
+    constexpr pointer operator->() const { return &node(n_current)->value; }
+
+    constexpr ConstListIterator& operator++() {
+      n_current = n_current->next;
+      return *this;
+    }
+    constexpr ConstListIterator operator++(int) {
+      ConstListIterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+    constexpr ConstListIterator& operator--() {
+      n_current = n_current->prev;
+      return *this;
+    }
+    constexpr ConstListIterator operator--(int) {
+      ConstListIterator tmp = *this;
+      --(*this);
+      return tmp;
+    }
+
+    // Friends, so that iterator and const_iterator compare either way round
+    friend constexpr bool operator==(const ConstListIterator& a,
+                                     const ConstListIterator& b) {
+      return a.n_current == b.n_current;
+    }
+    friend constexpr bool operator!=(const ConstListIterator& a,
+                                     const ConstListIterator& b) {
+      return a.n_current != b.n_current;
+    }
+  };
+
+  // iterator
+  constexpr iterator begin() { return iterator(sentinel_.next); }
+  constexpr iterator end() { return iterator(&sentinel_); }
+  constexpr const_iterator begin() const {
+    return const_iterator(sentinel_.next);
+  }
+  constexpr const_iterator end() const {
+    return const_iterator(const_cast<list_hook*>(&sentinel_));
+  }
+
+  // List Functions
+  S21_CONSTEXPR20 small_list();
+  S21_CONSTEXPR20 explicit small_list(size_type n);
+  S21_CONSTEXPR20 small_list(size_type n, const_reference value);
+  template <typename InputIt, typename = typename std::iterator_traits<
+                                  InputIt>::iterator_category>
+  S21_CONSTEXPR20 small_list(InputIt first, InputIt last);
+  S21_CONSTEXPR20 small_list(std::initializer_list<value_type> const& items);
+  S21_CONSTEXPR20 small_list(const small_list& l);
+  S21_CONSTEXPR20 small_list(small_list&& l);
+  S21_CONSTEXPR20 ~small_list() { clear(); }
+
+  // Operators
+  S21_CONSTEXPR20 small_list& operator=(small_list&& l);
+  S21_CONSTEXPR20 small_list& operator=(const small_list& l);
+
+  // List Element access
+  S21_CONSTEXPR20 const_reference front();
+  S21_CONSTEXPR20 const_reference back();
+
+  // Capacity
+  constexpr bool empty() const { return !list_size; }
+  constexpr size_type size() const { return list_size; }
+  constexpr size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(Node) / 2;
+  }
+  static constexpr size_type inline_capacity() { return N; }
+
+  // Modifiers
+  S21_CONSTEXPR20 void clear();
+  S21_CONSTEXPR20 iterator insert(const_iterator pos,
+                                  const_reference value);
+  S21_CONSTEXPR20 iterator insert(const_iterator pos, value_type&& value);
+  S21_CONSTEXPR20 void erase(const_iterator pos);
+  S21_CONSTEXPR20 void push_back(const_reference value);
+  S21_CONSTEXPR20 void push_back(value_type&& value);
+  S21_CONSTEXPR20 void pop_back();
+  S21_CONSTEXPR20 void push_front(const_reference value);
+  S21_CONSTEXPR20 void push_front(value_type&& value);
+  S21_CONSTEXPR20 void pop_front();
+  S21_CONSTEXPR20 void swap(small_list& other);
+  S21_CONSTEXPR20 void merge(small_list& other);
+  template <typename Compare>
+  S21_CONSTEXPR20 void merge(small_list& other, Compare comp);  // stable
+  S21_CONSTEXPR20 void splice(const_iterator pos, small_list& other);
+  S21_CONSTEXPR20 void reverse();
+  S21_CONSTEXPR20 void unique();
+  void sort() { sort(std::less<value_type>()); }
+  template <typename Compare>
+  void sort(Compare comp);  // stable, relinks nodes only
+
+  template <class... Args>
+  S21_CONSTEXPR20 iterator emplace(const_iterator pos, Args&&... args);
+  template <class... Args>
+  S21_CONSTEXPR20 void emplace_back(Args&&... args);
+  template <class... Args>
+  S21_CONSTEXPR20 void emplace_front(Args&&... args);
+
+ private:
+  template <class... Args>
+  S21_CONSTEXPR20 Node* create_node(Args&&... args);
+  S21_CONSTEXPR20 void destroy_node(list_hook* hook);
+  S21_CONSTEXPR20 list_hook* take(small_list& other, list_hook* hook);
+};
+
+template <typename T, std::size_t N>
+S21_CONSTEXPR20 small_list<T, N>::small_list()
+    : sentinel_{&sentinel_, &sentinel_},
+      list_size(0),
+      free_(nullptr),
+      fresh_(N) {}
+
+template <typename T, std::size_t N>
+S21_CONSTEXPR20 small_list<T, N>::small_list(size_type n) : small_list() {
+  for (size_type i = 0; i < n; i++) {
+    emplace_back();
+  }
+}
+
+template <typename T, std::size_t N>
+S21_CONSTEXPR20 small_list<T, N>::small_list(size_type n,
+                                             const_reference value)
+    : small_list() {
+  for (size_type i = 0; i < n; i++) {
+    push_back(value);
+  }
+}
+
+template <typename T, std::size_t N>
+template <typename InputIt, typename>
+S21_CONSTEXPR20 small_list<T, N>::small_list(InputIt first, InputIt last)
+    : small_list() {
+  for (; first != last; ++first) {
+    emplace_back(*first);
+  }
+}
+
+template <typename T, std::size_t N>
+S21_CONSTEXPR20 small_list<T, N>::small_list(
+    std::initializer_list<value_type> const& items)
+    : small_list(items.begin(), items.end()) {}
+
+template <typename T, std::size_t N>
+S21_CONSTEXPR20 small_list<T, N>::small_list(const small_list& l)
+    : small_list(l.begin(), l.end()) {}
+
+template <typename T, std::size_t N>
+S21_CONSTEXPR20 small_list<T, N>::small_list(small_list&& l) : small_list() {
+  splice(end(), l);
+}
+
+template <typename T, std::size_t N>
+S21_CONSTEXPR20 small_list<T, N>& small_list<T, N>::operator=(
+    small_list&& other) {
+  if (this == &other) return *this;
+  clear();
+  splice(end(), other);
+  return *this;
+}
+
+template <typename T, std::size_t N>
+S21_CONSTEXPR20 small_list<T, N>& small_list<T, N>::operator=(
+    const small_list& other) {
+  if (this == &other) return *this;
+  clear();
+  for (const auto& item : other) {
+    push_back(item);
+  }
+  return *this;
+}
+
+template <typename T, std::size_t N>
+S21_CONSTEXPR20 typename small_list<T, N>::const_reference
+small_list<T, N>::front() {
+  if (list_size == 0) {
+    throw "out_of_range";
+  }
+  return node(sentinel_.next)->value;
+}
+
+template <typename T, std::size_t N>
+S21_CONSTEXPR20 typename small_list<T, N>::const_reference
+small_list<T, N>::back() {
+  if (list_size == 0) {
+    throw "out_of_range";
+  }
+  return node(sentinel_.prev)->value;
+}
+
+// Also hands every inline node back, so the next fill starts at the front
+// of the array again
+template <typename T, std::size_t N>
+S21_CONSTEXPR20 void small_list<T, N>::clear() {
+  list_hook* current = sentinel_.next;
+  while (current != &sentinel_) {
+    list_hook* next = current->next;
+    destroy_node(current);
+    current = next;
+  }
+  sentinel_.next = sentinel_.prev = &sentinel_;
+  list_size = 0;
+  free_ = nullptr;
+  fresh_ = N;
+}
+
+template <typename T, std::size_t N>
+S21_CONSTEXPR20 typename small_list<T, N>::iterator small_list<T, N>::insert(
+    const_iterator pos, const_reference value) {
+  return emplace(pos, value);
+}
+
+template <typename T, std::size_t N>
+S21_CONSTEXPR20 typename small_list<T, N>::iterator small_list<T, N>::insert(
+    const_iterator pos, value_type&& value) {
+  return emplace(pos, std::move(value));
+}
+
+template <typename T, std::size_t N>
+S21_CONSTEXPR20 void small_list<T, N>::erase(const_iterator pos) {
+  list_hook* hook = pos.n_current;
+  if (hook == &sentinel_) {
+    throw "out_of_range";
+  }
+  detail::unlink_range(hook, hook);
+  destroy_node(hook);
+  list_size--;
+}
+
+template <typename T, std::size_t N>
+S21_CONSTEXPR20 void small_list<T, N>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, std::size_t N>
+S21_CONSTEXPR20 void small_list<T, N>::push_back(value_type&& value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, std::size_t N>
+S21_CONSTEXPR20 void small_list<T, N>::pop_back() {
+  if (list_size == 0) {
+    throw "out_of_range";
+  }
+  erase(iterator(sentinel_.prev));
+}
+
+template <typename T, std::size_t N>
+S21_CONSTEXPR20 void small_list<T, N>::push_front(const_reference value) {
+  emplace_front(value);
+}
+
+template <typename T, std::size_t N>
+S21_CONSTEXPR20 void small_list<T, N>::push_front(value_type&& value) {
+  emplace_front(std::move(value));
+}
+
+template <typename T, std::size_t N>
+S21_CONSTEXPR20 void small_list<T, N>::pop_front() {
+  if (list_size == 0) {
+    throw "out_of_range";
+  }
+  erase(iterator(sentinel_.next));
+}
+
+template <typename T, std::size_t N>
+S21_CONSTEXPR20 void small_list<T, N>::swap(small_list& other) {
+  if (this == &other) return;
+  small_list tmp(std::move(other));
+  other = std::move(*this);
+  *this = std::move(tmp);
+}
+
+template <typename T, std::size_t N>
+S21_CONSTEXPR20 void small_list<T, N>::merge(small_list& other) {
+  merge(other, std::less<value_type>());
+}
+
+// On equal keys the elements of *this come first
+template <typename T, std::size_t N>
+template <typename Compare>
+S21_CONSTEXPR20 void small_list<T, N>::merge(small_list& other,
+                                             Compare comp) {
+  if (this == &other) return;
+  list_hook* pos = sentinel_.next;
+  while (!other.empty()) {
+    list_hook* next = other.sentinel_.next;
+    while (pos != &sentinel_ && !comp(node(next)->value, node(pos)->value)) {
+      pos = pos->next;
+    }
+    list_hook* taken = take(other, next);
+    detail::link_range(pos, taken, taken);
+    list_size++;
+  }
+}
+
+template <typename T, std::size_t N>
+S21_CONSTEXPR20 void small_list<T, N>::splice(const_iterator pos,
+                                              small_list& other) {
+  if (this == &other) return;
+  while (!other.empty()) {
+    list_hook* taken = take(other, other.sentinel_.next);
+    detail::link_range(pos.n_current, taken, taken);
+    list_size++;
+  }
+}
+
+template <typename T, std::size_t N>
+S21_CONSTEXPR20 void small_list<T, N>::reverse() {
+  list_hook* current = &sentinel_;
+  do {
+    list_hook* next = current->next;
+    current->next = current->prev;
+    current->prev = next;
+    current = next;
+  } while (current != &sentinel_);
+}
+
+template <typename T, std::size_t N>
+S21_CONSTEXPR20 void small_list<T, N>::unique() {
+  if (list_size < 2) return;
+  list_hook* current = sentinel_.next;
+  while (current->next != &sentinel_) {
+    list_hook* next = current->next;
+    if (node(current)->value == node(next)->value) {
+      erase(iterator(next));
+    } else {
+      current = next;
+    }
+  }
+}
+
+template <typename T, std::size_t N>
+template <typename Compare>
+void small_list<T, N>::sort(Compare comp) {
+  auto less = [&comp](list_hook* a, list_hook* b) {
+    return comp(node(a)->value, node(b)->value);
+  };
+  detail::sort_ring(&sentinel_, less);
+}
+
+template <typename T, std::size_t N>
+template <class... Args>
+S21_CONSTEXPR20 typename small_list<T, N>::iterator small_list<T, N>::emplace(
+    const_iterator pos, Args&&... args) {
+  Node* created = create_node(std::forward<Args>(args)...);
+  detail::link_range(pos.n_current, created, created);
+  list_size++;
+  return iterator(created);
+}
+
+template <typename T, std::size_t N>
+template <class... Args>
+S21_CONSTEXPR20 void small_list<T, N>::emplace_back(Args&&... args) {
+  emplace(end(), std::forward<Args>(args)...);
+}
+
+template <typename T, std::size_t N>
+template <class... Args>
+S21_CONSTEXPR20 void small_list<T, N>::emplace_front(Args&&... args) {
+  emplace(begin(), std::forward<Args>(args)...);
+}
+
+// Recycled inline nodes first, then untouched ones, then the heap
+template <typename T, std::size_t N>
+template <class... Args>
+S21_CONSTEXPR20 typename small_list<T, N>::Node* small_list<T, N>::create_node(
+    Args&&... args) {
+  Node* created = nullptr;
+  if (free_) {
+    created = node(free_);
+  } else if (fresh_) {
+    created = &inline_[N - fresh_];
+  } else {
+    created = new Node();
+    created->on_heap = true;
+  }
+  try {
+#if __cplusplus >= 202002L
+    std::construct_at(&created->value, std::forward<Args>(args)...);
+#else
+    ::new (static_cast<void*>(&created->value))
+        T(std::forward<Args>(args)...);
+#endif
+  } catch (...) {
+    if (created->on_heap) delete created;
+    throw;
+  }
+  if (created->on_heap) return created;
+  if (free_) {
+    free_ = free_->next;
+  } else {
+    fresh_--;
+  }
+  return created;
+}
+
+template <typename T, std::size_t N>
+S21_CONSTEXPR20 void small_list<T, N>::destroy_node(list_hook* hook) {
+  Node* target = node(hook);
+  std::destroy_at(&target->value);
+  if (target->on_heap) {
+    delete target;
+  } else {
+    target->next = free_;
+    free_ = target;
+  }
+}
+
+// Detaches hook from other and returns a node of this list holding its
+// value: the node itself if it is on the heap, otherwise a new one the value
+// is moved into. If that move throws, other is left as it was.
+template <typename T, std::size_t N>
+S21_CONSTEXPR20 list_hook* small_list<T, N>::take(small_list& other,
+                                                  list_hook* hook) {
+  Node* taken = node(hook);
+  if (!taken->on_heap) taken = create_node(std::move(node(hook)->value));
+  detail::unlink_range(hook, hook);
+  other.list_size--;
+  if (taken != hook) other.destroy_node(hook);
+  return taken;
+}
+
+}  // namespace s21
+#endif
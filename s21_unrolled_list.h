@@ -0,0 +1,693 @@
+#ifndef S21_UNROLLED_LIST_H
+#define S21_UNROLLED_LIST_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+namespace detail {
+// About four cache lines of payload per block, but never fewer than 4 slots
+template <typename T>
+constexpr std::size_t unrolled_block_size() {
+  return sizeof(T) * 4 >= 256 ? 4 : 256 / sizeof(T);
+}
+}  // namespace detail
+
+// Doubly linked list of fixed-capacity blocks. Every block stores up to N
+// elements contiguously, so a scan touches one node per N elements and the
+// per-element overhead is two pointers and a count divided by N.
+//
+// Unlike list, inserting or erasing shifts elements inside a block: it
+// invalidates iterators to the affected block (and to the block it is split
+// from, merged with or borrows from). Erasing keeps every block but a lone
+// one at least half full. splice and swap keep iterators valid except at pos.
+template <typename T, std::size_t N = detail::unrolled_block_size<T>()>
+class unrolled_list {
+  static_assert(N >= 2, "unrolled_list blocks need room for two elements");
+
+ public:
+  // List Member Type
+  class ListIterator;
+  class ConstListIterator;
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+  using iterator = ListIterator;
+  using const_iterator = ConstListIterator;
+
+ private:
+  struct BlockBase {
+    BlockBase* next;
+    BlockBase* prev;
+    size_type count;
+  };
+
+  struct Block : BlockBase {
+    alignas(T) unsigned char storage[N * sizeof(T)];
+    Block() : BlockBase{nullptr, nullptr, 0} {}
+    T* slot(size_type i) { return reinterpret_cast<T*>(storage) + i; }
+  };
+
+  BlockBase sentinel_;
+  size_type list_size;
+
+  static Block* block(BlockBase* base) { return static_cast<Block*>(base); }
+
+ public:
+  class ListIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    BlockBase* n_block;
+    size_type n_index;
+
+    ListIterator() : n_block(nullptr), n_index(0) {}
+    ListIterator(BlockBase* base, size_type index)
+        : n_block(base), n_index(index) {}
+
+    T& operator*() const { return *block(n_block)->slot(n_index); }
+    T* operator->() const { return block(n_block)->slot(n_index); }
+
+    ListIterator& operator++() {
+      if (++n_index == n_block->count) {
+        n_block = n_block->next;
+        n_index = 0;
+      }
+      return *this;
+    }
+    ListIterator operator++(int) {
+      ListIterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+
+    ListIterator& operator--() {
+      if (n_index == 0) {
+        n_block = n_block->prev;
+        n_index = n_block->count;
+      }
+      --n_index;
+      return *this;
+    }
+    ListIterator operator--(int) {
+      ListIterator tmp = *this;
+      --(*this);
+      return tmp;
+    }
+
+    bool operator==(const ListIterator& other) const {
+      return n_block == other.n_block && n_index == other.n_index;
+    }
+    bool operator!=(const ListIterator& other) const {
+      return !(*this == other);
+    }
+  };
+
+  class ConstListIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    BlockBase* n_block;
+    size_type n_index;
+
+    ConstListIterator() : n_block(nullptr), n_index(0) {}
+    ConstListIterator(BlockBase* base, size_type index)
+        : n_block(base), n_index(index) {}
+    ConstListIterator(const ListIterator& it)
+        : n_block(it.n_block), n_index(it.n_index) {}
+
+    const T& operator*() const { return *block(n_block)->slot(n_index); }
+    const T* operator->() const { return block(n_block)->slot(n_index); }
+
+    ConstListIterator& operator++() {
+      if (++n_index == n_block->count) {
+        n_block = n_block->next;
+        n_index = 0;
+      }
+      return *this;
+    }
+    ConstListIterator operator++(int) {
+      ConstListIterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+
+    ConstListIterator& operator--() {
+      if (n_index == 0) {
+        n_block = n_block->prev;
+        n_index = n_block->count;
+      }
+      --n_index;
+      return *this;
+    }
+    ConstListIterator operator--(int) {
+      ConstListIterator tmp = *this;
+      --(*this);
+      return tmp;
+    }
+
+    // Friends, so that iterator and const_iterator compare either way round
+    friend bool operator==(const ConstListIterator& a,
+                           const ConstListIterator& b) {
+      return a.n_block == b.n_block && a.n_index == b.n_index;
+    }
+    friend bool operator!=(const ConstListIterator& a,
+                           const ConstListIterator& b) {
+      return !(a == b);
+    }
+  };
+
+  // iterator
+  iterator begin() { return iterator(sentinel_.next, 0); }
+  iterator end() { return iterator(&sentinel_, 0); }
+  const_iterator begin() const { return const_iterator(sentinel_.next, 0); }
+  const_iterator end() const {
+    return const_iterator(const_cast<BlockBase*>(&sentinel_), 0);
+  }
+
+  // List Functions
+  unrolled_list();
+  explicit unrolled_list(size_type n);
+  unrolled_list(std::initializer_list<value_type> const& items);
+  unrolled_list(const unrolled_list& l);
+  unrolled_list(unrolled_list&& l);
+  ~unrolled_list();
+
+  // Operators
+  unrolled_list& operator=(unrolled_list&& l);
+  unrolled_list& operator=(const unrolled_list& l);
+
+  // List Element access
+  const_reference front();
+  const_reference back();
+
+  // Capacity
+  bool empty() const { return !list_size; }
+  size_type size() const { return list_size; }
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(Block) * N / 2;
+  }
+  static constexpr size_type block_capacity() { return N; }
+
+  // Modifiers
+  void clear();
+  iterator insert(const_iterator pos, const_reference value);
+  iterator insert(const_iterator pos, value_type&& value);
+  iterator erase(const_iterator pos);  // returns the element after pos
+  void push_back(const_reference value);
+  void push_back(value_type&& value);
+  void pop_back();
+  void push_front(const_reference value);
+  void push_front(value_type&& value);
+  void pop_front();
+  void swap(unrolled_list& other);
+  void merge(unrolled_list& other);
+  template <typename Compare>
+  void merge(unrolled_list& other, Compare comp);
+  void splice(const_iterator pos, unrolled_list& other);
+  void reverse();
+  void unique();
+  void sort();
+  template <typename Compare>
+  void sort(Compare comp);
+
+  template <class... Args>
+  iterator emplace(const_iterator pos, Args&&... args);
+  template <class... Args>
+  void emplace_back(Args&&... args);
+  template <class... Args>
+  void emplace_front(Args&&... args);
+
+ private:
+  Block* create_block(BlockBase* pos);
+  void destroy_block(BlockBase* base);
+  iterator split(iterator pos);
+  iterator rebalance(Block* b, size_type index);
+  void append_front_of(Block* to, Block* from, size_type k);
+  void prepend_back_of(Block* to, Block* from, size_type k);
+  void steal_blocks(unrolled_list& other);
+  void adopt_sentinel();
+};
+
+template <typename T, std::size_t N>
+unrolled_list<T, N>::unrolled_list()
+    : sentinel_{&sentinel_, &sentinel_, 0}, list_size(0) {}
+
+template <typename T, std::size_t N>
+unrolled_list<T, N>::unrolled_list(size_type n) : unrolled_list() {
+  for (size_type i = 0; i < n; i++) {
+    emplace_back();
+  }
+}
+
+template <typename T, std::size_t N>
+unrolled_list<T, N>::unrolled_list(
+    std::initializer_list<value_type> const& items)
+    : unrolled_list() {
+  for (const auto& item : items) {
+    push_back(item);
+  }
+}
+
+template <typename T, std::size_t N>
+unrolled_list<T, N>::unrolled_list(const unrolled_list& l) : unrolled_list() {
+  *this = l;
+}
+
+template <typename T, std::size_t N>
+unrolled_list<T, N>::unrolled_list(unrolled_list&& l) : unrolled_list() {
+  steal_blocks(l);
+}
+
+template <typename T, std::size_t N>
+unrolled_list<T, N>::~unrolled_list() {
+  clear();
+}
+
+template <typename T, std::size_t N>
+unrolled_list<T, N>& unrolled_list<T, N>::operator=(unrolled_list&& other) {
+  if (this == &other) return *this;
+  clear();
+  steal_blocks(other);
+  return *this;
+}
+
+template <typename T, std::size_t N>
+unrolled_list<T, N>& unrolled_list<T, N>::operator=(
+    const unrolled_list& other) {
+  if (this == &other) return *this;
+  clear();
+  for (const auto& item : other) {
+    push_back(item);
+  }
+  return *this;
+}
+
+template <typename T, std::size_t N>
+typename unrolled_list<T, N>::const_reference unrolled_list<T, N>::front() {
+  if (list_size == 0) {
+    throw "out_of_range";
+  }
+  return *block(sentinel_.next)->slot(0);
+}
+
+template <typename T, std::size_t N>
+typename unrolled_list<T, N>::const_reference unrolled_list<T, N>::back() {
+  if (list_size == 0) {
+    throw "out_of_range";
+  }
+  return *block(sentinel_.prev)->slot(sentinel_.prev->count - 1);
+}
+
+template <typename T, std::size_t N>
+void unrolled_list<T, N>::clear() {
+  BlockBase* current = sentinel_.next;
+  while (current != &sentinel_) {
+    BlockBase* next = current->next;
+    destroy_block(current);
+    current = next;
+  }
+  sentinel_.next = sentinel_.prev = &sentinel_;
+  list_size = 0;
+}
+
+template <typename T, std::size_t N>
+typename unrolled_list<T, N>::iterator unrolled_list<T, N>::insert(
+    const_iterator pos, const_reference value) {
+  return emplace(pos, value);
+}
+
+template <typename T, std::size_t N>
+typename unrolled_list<T, N>::iterator unrolled_list<T, N>::insert(
+    const_iterator pos, value_type&& value) {
+  return emplace(pos, std::move(value));
+}
+
+template <typename T, std::size_t N>
+typename unrolled_list<T, N>::iterator unrolled_list<T, N>::erase(
+    const_iterator pos) {
+  BlockBase* base = pos.n_block;
+  if (base == &sentinel_) {
+    throw "out_of_range";
+  }
+  Block* b = block(base);
+  std::move(b->slot(pos.n_index + 1), b->slot(b->count), b->slot(pos.n_index));
+  b->slot(--b->count)->~T();
+  list_size--;
+  return rebalance(b, pos.n_index);
+}
+
+template <typename T, std::size_t N>
+void unrolled_list<T, N>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, std::size_t N>
+void unrolled_list<T, N>::push_back(value_type&& value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, std::size_t N>
+void unrolled_list<T, N>::pop_back() {
+  if (list_size == 0) {
+    throw "out_of_range";
+  }
+  Block* b = block(sentinel_.prev);
+  b->slot(--b->count)->~T();
+  list_size--;
+  rebalance(b, b->count);
+}
+
+template <typename T, std::size_t N>
+void unrolled_list<T, N>::push_front(const_reference value) {
+  emplace_front(value);
+}
+
+template <typename T, std::size_t N>
+void unrolled_list<T, N>::push_front(value_type&& value) {
+  emplace_front(std::move(value));
+}
+
+template <typename T, std::size_t N>
+void unrolled_list<T, N>::pop_front() {
+  if (list_size == 0) {
+    throw "out_of_range";
+  }
+  erase(begin());
+}
+
+template <typename T, std::size_t N>
+void unrolled_list<T, N>::swap(unrolled_list& other) {
+  std::swap(sentinel_, other.sentinel_);
+  std::swap(list_size, other.list_size);
+  adopt_sentinel();
+  other.adopt_sentinel();
+}
+
+template <typename T, std::size_t N>
+void unrolled_list<T, N>::merge(unrolled_list& other) {
+  merge(other, std::less<value_type>());
+}
+
+// Elements move into freshly packed blocks; both inputs end up empty
+template <typename T, std::size_t N>
+template <typename Compare>
+void unrolled_list<T, N>::merge(unrolled_list& other, Compare comp) {
+  if (this == &other || other.empty()) return;
+  unrolled_list result;
+  iterator first = begin();
+  iterator second = other.begin();
+  while (first != end() && second != other.end()) {
+    if (comp(*second, *first)) {
+      result.emplace_back(std::move(*second));
+      ++second;
+    } else {
+      result.emplace_back(std::move(*first));
+      ++first;
+    }
+  }
+  for (; first != end(); ++first) result.emplace_back(std::move(*first));
+  for (; second != other.end(); ++second) {
+    result.emplace_back(std::move(*second));
+  }
+  other.clear();
+  *this = std::move(result);
+}
+
+template <typename T, std::size_t N>
+void unrolled_list<T, N>::splice(const_iterator pos, unrolled_list& other) {
+  if (this == &other || other.empty()) return;
+  BlockBase* at = split(iterator(pos.n_block, pos.n_index)).n_block;
+  BlockBase* first = other.sentinel_.next;
+  BlockBase* last = other.sentinel_.prev;
+  BlockBase* before = at->prev;
+  first->prev = before;
+  last->next = at;
+  before->next = first;
+  at->prev = last;
+  list_size += other.list_size;
+  other.sentinel_.next = other.sentinel_.prev = &other.sentinel_;
+  other.list_size = 0;
+}
+
+template <typename T, std::size_t N>
+void unrolled_list<T, N>::reverse() {
+  BlockBase* current = &sentinel_;
+  do {
+    std::swap(current->next, current->prev);
+    current = current->prev;
+    if (current != &sentinel_) {
+      Block* b = block(current);
+      std::reverse(b->slot(0), b->slot(b->count));
+    }
+  } while (current != &sentinel_);
+}
+
+template <typename T, std::size_t N>
+void unrolled_list<T, N>::unique() {
+  if (list_size < 2) return;
+  iterator write = begin();
+  iterator read = begin();
+  size_type kept = 1;
+  for (++read; read != end(); ++read) {
+    if (!(*read == *write)) {
+      ++write;
+      if (write != read) *write = std::move(*read);
+      kept++;
+    }
+  }
+  while (list_size > kept) pop_back();
+}
+
+template <typename T, std::size_t N>
+void unrolled_list<T, N>::sort() {
+  sort(std::less<value_type>());
+}
+
+// Stable. Elements are moved out to a contiguous buffer, sorted there and
+// moved back into the same slots, so the block layout is unchanged.
+template <typename T, std::size_t N>
+template <typename Compare>
+void unrolled_list<T, N>::sort(Compare comp) {
+  if (list_size < 2) return;
+  std::vector<T> buffer;
+  buffer.reserve(list_size);
+  for (auto& item : *this) buffer.push_back(std::move(item));
+  std::stable_sort(buffer.begin(), buffer.end(), comp);
+  auto source = buffer.begin();
+  for (auto& item : *this) item = std::move(*source++);
+}
+
+template <typename T, std::size_t N>
+template <class... Args>
+typename unrolled_list<T, N>::iterator unrolled_list<T, N>::emplace(
+    const_iterator pos, Args&&... args) {
+  BlockBase* base = pos.n_block;
+  size_type index = pos.n_index;
+  // Appending at the end of the previous block avoids a shift
+  if (index == 0 && base->prev != &sentinel_ && base->prev->count < N) {
+    base = base->prev;
+    index = base->count;
+  }
+  if (base == &sentinel_ || (index == 0 && base->count == N)) {
+    base = create_block(base);
+  } else if (base->count == N) {
+    iterator at = split(iterator(base, index));
+    base = at.n_block;
+    index = at.n_index;
+    if (index == 0) {
+      // Lands right after the cut: append to the first half instead
+      base = base->prev;
+      index = base->count;
+    }
+  }
+
+  Block* b = block(base);
+  try {
+    if (index == b->count) {
+      new (b->slot(index)) T(std::forward<Args>(args)...);
+    } else {
+      T value(std::forward<Args>(args)...);
+      new (b->slot(b->count)) T(std::move(*b->slot(b->count - 1)));
+      std::move_backward(b->slot(index), b->slot(b->count - 1),
+                         b->slot(b->count));
+      *b->slot(index) = std::move(value);
+    }
+  } catch (...) {
+    if (b->count == 0) destroy_block(b);
+    throw;
+  }
+  b->count++;
+  list_size++;
+  return iterator(b, index);
+}
+
+template <typename T, std::size_t N>
+template <class... Args>
+void unrolled_list<T, N>::emplace_back(Args&&... args) {
+  emplace(end(), std::forward<Args>(args)...);
+}
+
+template <typename T, std::size_t N>
+template <class... Args>
+void unrolled_list<T, N>::emplace_front(Args&&... args) {
+  emplace(begin(), std::forward<Args>(args)...);
+}
+
+// Allocates an empty block and links it before pos
+template <typename T, std::size_t N>
+typename unrolled_list<T, N>::Block* unrolled_list<T, N>::create_block(
+    BlockBase* pos) {
+  Block* b = new Block();
+  b->next = pos;
+  b->prev = pos->prev;
+  pos->prev->next = b;
+  pos->prev = b;
+  return b;
+}
+
+// Unlinks the block and destroys the elements it still holds
+template <typename T, std::size_t N>
+void unrolled_list<T, N>::destroy_block(BlockBase* base) {
+  base->prev->next = base->next;
+  base->next->prev = base->prev;
+  Block* b = block(base);
+  for (size_type i = 0; i < b->count; i++) {
+    b->slot(i)->~T();
+  }
+  delete b;
+}
+
+// Cuts the block at pos so that pos becomes the first element of a block.
+// Returns the new position of the element pos referred to.
+template <typename T, std::size_t N>
+typename unrolled_list<T, N>::iterator unrolled_list<T, N>::split(
+    iterator pos) {
+  if (pos.n_index == 0) return pos;
+  Block* b = block(pos.n_block);
+  // A full block is cut in the middle so that both halves have room
+  size_type cut = pos.n_index;
+  if (b->count == N && cut != N / 2) cut = N / 2;
+  Block* tail = create_block(b->next);
+  for (size_type i = cut; i < b->count; i++) {
+    new (tail->slot(i - cut)) T(std::move(*b->slot(i)));
+    b->slot(i)->~T();
+  }
+  tail->count = b->count - cut;
+  b->count = cut;
+  if (pos.n_index >= cut) return iterator(tail, pos.n_index - cut);
+  return iterator(b, pos.n_index);
+}
+
+// Keeps b at least half full after it lost an element: a neighbour that
+// fits is merged with it, otherwise b borrows from that neighbour until the
+// two are even. Returns the new position of the element that was at index.
+template <typename T, std::size_t N>
+typename unrolled_list<T, N>::iterator unrolled_list<T, N>::rebalance(
+    Block* b, size_type index) {
+  if (b->count == 0) {
+    BlockBase* next = b->next;
+    destroy_block(b);
+    return iterator(next, 0);
+  }
+  if (b->count < N / 2 && b->next != &sentinel_) {
+    Block* next = block(b->next);
+    if (b->count + next->count <= N) {
+      append_front_of(b, next, next->count);
+      destroy_block(next);
+    } else {
+      append_front_of(b, next, (next->count - b->count) / 2);
+    }
+  } else if (b->count < N / 2 && b->prev != &sentinel_) {
+    Block* prev = block(b->prev);
+    if (prev->count + b->count <= N) {
+      index += prev->count;
+      append_front_of(prev, b, b->count);
+      destroy_block(b);
+      b = prev;
+    } else {
+      size_type k = (prev->count - b->count) / 2;
+      prepend_back_of(b, prev, k);
+      index += k;
+    }
+  }
+  if (index == b->count) return iterator(b->next, 0);
+  return iterator(b, index);
+}
+
+// Moves the first k elements of from to the end of to
+template <typename T, std::size_t N>
+void unrolled_list<T, N>::append_front_of(Block* to, Block* from,
+                                          size_type k) {
+  for (size_type i = 0; i < k; i++) {
+    new (to->slot(to->count + i)) T(std::move(*from->slot(i)));
+  }
+  to->count += k;
+  std::move(from->slot(k), from->slot(from->count), from->slot(0));
+  for (size_type i = from->count - k; i < from->count; i++) {
+    from->slot(i)->~T();
+  }
+  from->count -= k;
+}
+
+// Moves the last k elements of from to the front of to
+template <typename T, std::size_t N>
+void unrolled_list<T, N>::prepend_back_of(Block* to, Block* from,
+                                          size_type k) {
+  const size_type count = to->count;
+  for (size_type i = count + k; i-- > k;) {
+    if (i >= count) {
+      new (to->slot(i)) T(std::move(*to->slot(i - k)));
+    } else {
+      *to->slot(i) = std::move(*to->slot(i - k));
+    }
+  }
+  const size_type first = from->count - k;
+  for (size_type i = 0; i < k; i++) {
+    if (i >= count) {
+      new (to->slot(i)) T(std::move(*from->slot(first + i)));
+    } else {
+      *to->slot(i) = std::move(*from->slot(first + i));
+    }
+    from->slot(first + i)->~T();
+  }
+  to->count += k;
+  from->count = first;
+}
+
+template <typename T, std::size_t N>
+void unrolled_list<T, N>::adopt_sentinel() {
+  if (list_size == 0) {
+    sentinel_.next = sentinel_.prev = &sentinel_;
+  } else {
+    sentinel_.next->prev = sentinel_.prev->next = &sentinel_;
+  }
+}
+
+template <typename T, std::size_t N>
+void unrolled_list<T, N>::steal_blocks(unrolled_list& other) {
+  sentinel_ = other.sentinel_;
+  list_size = other.list_size;
+  adopt_sentinel();
+  other.sentinel_.next = other.sentinel_.prev = &other.sentinel_;
+  other.list_size = 0;
+}
+
+}  // namespace s21
+#endif
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "s21_concurrent_list.h"
+
+TEST(concurrent_list_suit, single_thread) {
+  s21::concurrent_list<std::string> queue{"aannemar", "rdontos"};
+  ASSERT_FALSE(queue.empty());
+  queue.push_back("tsherman");
+  queue.push_front("john");
+  ASSERT_EQ(*queue.try_pop(), "john");
+  ASSERT_EQ(*queue.try_pop_front(), "aannemar");
+  queue.pop_front();
+  ASSERT_EQ(*queue.try_pop(), "tsherman");
+  ASSERT_TRUE(queue.empty());
+  ASSERT_FALSE(queue.try_pop().has_value());
+  ASSERT_ANY_THROW(queue.pop_front());
+}
+
+TEST(concurrent_list_suit, push_front_order) {
+  s21::concurrent_list<int> queue;
+  queue.push_back(3);
+  queue.push_front(2);
+  queue.push_front(1);
+  queue.push_back(4);
+  for (int expected = 1; expected <= 4; expected++) {
+    ASSERT_EQ(*queue.try_pop(), expected);
+  }
+  queue.push_front(5);
+  ASSERT_EQ(*queue.try_pop(), 5);
+  ASSERT_TRUE(queue.empty());
+}
+
+TEST(concurrent_list_suit, move_only_and_leftovers) {
+  s21::concurrent_list<std::unique_ptr<int>> queue;
+  queue.push_back(std::make_unique<int>(1));
+  queue.emplace_front(new int(0));
+  ASSERT_EQ(**queue.try_pop(), 0);
+  queue.push_back(std::make_unique<int>(2));
+  // The destructor releases the values still queued
+}
+
+TEST(concurrent_list_suit, stress) {
+  constexpr int kProducers = 4;
+  constexpr int kConsumers = 4;
+  constexpr int kPerProducer = 20000;
+  s21::concurrent_list<int> queue;
+  std::vector<std::atomic<int>> seen(kProducers * kPerProducer);
+  std::atomic<int> consumed{0};
+  std::vector<std::thread> threads;
+  for (int p = 0; p < kProducers; p++) {
+    threads.emplace_back([&queue, p] {
+      for (int i = 0; i < kPerProducer; i++) {
+        int value = p * kPerProducer + i;
+        if (i % 5 == 0) {
+          queue.push_front(value);
+        } else {
+          queue.push_back(value);
+        }
+      }
+    });
+  }
+  for (int c = 0; c < kConsumers; c++) {
+    threads.emplace_back([&] {
+      while (consumed.load() < kProducers * kPerProducer) {
+        if (auto value = queue.try_pop()) {
+          seen[*value].fetch_add(1);
+          consumed.fetch_add(1);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  ASSERT_TRUE(queue.empty());
+  for (auto& count : seen) ASSERT_EQ(count.load(), 1);
+}
+
+TEST(concurrent_list_suit, fifo_per_producer) {
+  constexpr int kProducers = 3;
+  constexpr int kPerProducer = 20000;
+  s21::concurrent_list<std::pair<int, int>> queue;
+  std::vector<std::thread> threads;
+  for (int p = 0; p < kProducers; p++) {
+    threads.emplace_back([&queue, p] {
+      for (int i = 0; i < kPerProducer; i++) queue.push_back({p, i});
+    });
+  }
+  std::vector<int> last(kProducers, -1);
+  int received = 0;
+  bool ordered = true;
+  while (received < kProducers * kPerProducer) {
+    if (auto item = queue.try_pop()) {
+      ordered = ordered && item->second > last[item->first];
+      last[item->first] = item->second;
+      received++;
+    }
+  }
+  for (auto& thread : threads) thread.join();
+  ASSERT_TRUE(ordered);
+}
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "s21_indexed_list.h"
+
+namespace {
+
+template <typename T>
+std::vector<T> values(const s21::indexed_list<T>& list) {
+  return std::vector<T>(list.begin(), list.end());
+}
+
+// at() and index_of() agree with the iteration order
+template <typename T>
+void expect_indexed(const s21::indexed_list<T>& list,
+                    const std::vector<T>& expected) {
+  ASSERT_EQ(list.size(), expected.size());
+  ASSERT_EQ(values(list), expected);
+  size_t i = 0;
+  for (auto it = list.begin(); it != list.end(); ++it, ++i) {
+    ASSERT_EQ(list.at(i), expected[i]);
+    ASSERT_EQ(list.index_of(it), i);
+  }
+  ASSERT_EQ(list.index_of(list.end()), expected.size());
+}
+
+}  // namespace
+
+TEST(indexed_list_suit, constructors) {
+  s21::indexed_list<int> list{5, 3, 8};
+  expect_indexed(list, {5, 3, 8});
+  s21::indexed_list<int> copy(list);
+  expect_indexed(copy, {5, 3, 8});
+  s21::indexed_list<int> moved(std::move(copy));
+  ASSERT_TRUE(copy.empty());
+  expect_indexed(moved, {5, 3, 8});
+  s21::indexed_list<int> sized(4);
+  expect_indexed(sized, {0, 0, 0, 0});
+  sized = list;
+  expect_indexed(sized, {5, 3, 8});
+  moved = std::move(sized);
+  ASSERT_TRUE(sized.empty());
+  expect_indexed(moved, {5, 3, 8});
+}
+
+TEST(indexed_list_suit, positional) {
+  s21::indexed_list<std::string> list;
+  ASSERT_ANY_THROW(list.at(0));
+  ASSERT_ANY_THROW(list.insert_at(1, "x"));
+  ASSERT_ANY_THROW(list.front());
+  ASSERT_ANY_THROW(list.pop_back());
+  list.insert_at(0, "b");
+  list.insert_at(0, "a");
+  list.insert_at(2, "d");
+  auto it = list.insert_at(2, "c");
+  ASSERT_EQ(*it, "c");
+  expect_indexed<std::string>(list, {"a", "b", "c", "d"});
+  list[1] = "B";
+  list.erase_at(0);
+  expect_indexed<std::string>(list, {"B", "c", "d"});
+  ASSERT_ANY_THROW(list.erase_at(3));
+  ASSERT_EQ(*list.erase(list.begin()), "c");
+  ASSERT_ANY_THROW(list.erase(list.end()));
+  list.pop_front();
+  list.pop_back();
+  ASSERT_TRUE(list.empty());
+}
+
+TEST(indexed_list_suit, const_iterator) {
+  using list = s21::indexed_list<int>;
+  static_assert(std::is_convertible_v<list::iterator, list::const_iterator>);
+  static_assert(
+      !std::is_convertible_v<list::const_iterator, list::iterator>);
+  static_assert(
+      std::is_same_v<decltype(*std::declval<list::const_iterator>()),
+                     const int&>);
+  list s21list{1, 2, 3};
+  const list& view = s21list;
+  list::const_iterator it = view.begin();
+  ASSERT_EQ(*++it, 2);
+  ASSERT_EQ(*it--, 2);
+  ASSERT_TRUE(it == s21list.begin());
+  ASSERT_TRUE(s21list.begin() == it);
+  ASSERT_TRUE(it != view.end());
+  ASSERT_EQ(view.index_of(++it), 1U);
+  s21list.insert(it, 5);
+  expect_indexed(s21list, {1, 5, 2, 3});
+}
+
+// Random edits against a vector, checking every position after each round
+TEST(indexed_list_suit, random_edits) {
+  s21::indexed_list<int> list;
+  std::vector<int> model;
+  std::uint32_t state = 12345;
+  auto next = [&state]() {
+    state = state * 1103515245U + 12345U;
+    return state >> 8;
+  };
+  for (int round = 0; round < 40; round++) {
+    for (int i = 0; i < 50; i++) {
+      size_t index = next() % (model.size() + 1);
+      int value = static_cast<int>(next() % 1000);
+      if (!model.empty() && next() % 3 == 0) {
+        index %= model.size();
+        list.erase_at(index);
+        model.erase(model.begin() + static_cast<std::ptrdiff_t>(index));
+      } else if (next() % 2) {
+        list.insert_at(index, value);
+        model.insert(model.begin() + static_cast<std::ptrdiff_t>(index),
+                     value);
+      } else {
+        auto pos = list.begin();
+        std::advance(pos, static_cast<std::ptrdiff_t>(index));
+        list.insert(pos, value);
+        model.insert(model.begin() + static_cast<std::ptrdiff_t>(index),
+                     value);
+      }
+    }
+    expect_indexed(list, model);
+  }
+}
+
+TEST(indexed_list_suit, splice_swap_sort) {
+  s21::indexed_list<int> list{1, 2, 3};
+  s21::indexed_list<int> other{7, 8};
+  auto pos = list.begin();
+  ++pos;
+  list.splice(pos, other);
+  ASSERT_TRUE(other.empty());
+  expect_indexed(list, {1, 7, 8, 2, 3});
+  other.push_back(0);
+  list.splice(list.end(), other);
+  expect_indexed(list, {1, 7, 8, 2, 3, 0});
+  list.swap(other);
+  ASSERT_TRUE(list.empty());
+  other.sort();
+  expect_indexed(other, {0, 1, 2, 3, 7, 8});
+  other.sort([](int a, int b) { return a % 2 < b % 2; });
+  expect_indexed(other, {0, 2, 8, 1, 3, 7});
+  other.insert_at(3, 4);
+  ASSERT_EQ(other.at(3), 4);
+  ASSERT_EQ(other.at(4), 1);
+}
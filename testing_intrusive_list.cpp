@@ -0,0 +1,214 @@
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "s21_intrusive_list.h"
+
+namespace {
+
+struct timer {
+  explicit timer(int d = 0, int i = 0) : deadline(d), id(i) {}
+  timer(const timer&) = delete;
+  timer& operator=(const timer&) = delete;
+
+  int deadline;
+  int id;
+  s21::list_hook hook;
+  s21::list_hook expired_hook;
+};
+
+bool operator<(const timer& a, const timer& b) {
+  return a.deadline < b.deadline;
+}
+bool operator==(const timer& a, const timer& b) {
+  return a.deadline == b.deadline;
+}
+
+using timer_list = s21::intrusive_list<timer, &timer::hook>;
+
+std::vector<int> ids(const timer_list& list) {
+  std::vector<int> result;
+  for (const timer& item : list) result.push_back(item.id);
+  return result;
+}
+
+}  // namespace
+
+TEST(intrusive_list_suit, push_pop) {
+  timer a(1, 0), b(2, 1), c(3, 2);
+  timer_list list;
+  ASSERT_TRUE(list.empty());
+  ASSERT_ANY_THROW(list.front());
+  ASSERT_ANY_THROW(list.pop_back());
+  list.push_back(b);
+  list.push_back(c);
+  list.push_front(a);
+  ASSERT_EQ(list.size(), 3U);
+  ASSERT_EQ(&list.front(), &a);
+  ASSERT_EQ(&list.back(), &c);
+  ASSERT_TRUE(timer_list::is_linked(b));
+  list.pop_front();
+  list.pop_back();
+  ASSERT_FALSE(timer_list::is_linked(a));
+  ASSERT_FALSE(timer_list::is_linked(c));
+  ASSERT_EQ(ids(list), std::vector<int>({1}));
+}
+
+TEST(intrusive_list_suit, const_iterator) {
+  static_assert(std::is_convertible_v<timer_list::iterator,
+                                      timer_list::const_iterator>);
+  static_assert(!std::is_convertible_v<timer_list::const_iterator,
+                                       timer_list::iterator>);
+  static_assert(
+      std::is_same_v<decltype(*std::declval<timer_list::const_iterator>()),
+                     const timer&>);
+  timer a(1, 0), b(2, 1);
+  timer_list list;
+  list.push_back(a);
+  list.push_back(b);
+  const timer_list& view = list;
+  timer_list::const_iterator it = view.begin();
+  ASSERT_EQ((it++)->id, 0);
+  ASSERT_EQ(it->id, 1);
+  ASSERT_TRUE(it == --list.end());
+  ASSERT_TRUE(list.begin() != it);
+  ASSERT_TRUE(++it == view.end());
+  list.erase(a);
+  list.insert(--it, a);
+  ASSERT_EQ(ids(list), std::vector<int>({0, 1}));
+}
+
+// Not standard layout: the hook sits after a vtable pointer and a base
+struct task_base {
+  virtual ~task_base() = default;
+  virtual int run() const = 0;
+  long long queued_at = 0;
+};
+struct task : task_base {
+  explicit task(int p) : priority(p) {}
+  int run() const override { return priority; }
+  s21::list_hook hook;
+  int priority;
+};
+
+TEST(intrusive_list_suit, non_standard_layout) {
+  static_assert(!std::is_standard_layout_v<task>);
+  std::deque<task> tasks;
+  s21::intrusive_list<task, &task::hook> queue;
+  for (int i = 0; i < 5; i++) queue.push_front(tasks.emplace_back(i));
+  int expected = 4;
+  for (const task& item : queue) ASSERT_EQ(item.run(), expected--);
+  ASSERT_EQ(&queue.back(), &tasks.front());
+  ASSERT_EQ(queue.begin()->priority, 4);
+}
+
+TEST(intrusive_list_suit, erase_object) {
+  std::deque<timer> timers;
+  timer_list list;
+  for (int i = 0; i < 5; i++) {
+    timers.emplace_back(i, i);
+    list.push_back(timers.back());
+  }
+  list.erase(timers[2]);
+  list.erase(timers[0]);
+  list.erase(timers[4]);
+  ASSERT_EQ(ids(list), std::vector<int>({1, 3}));
+  ASSERT_FALSE(timer_list::is_linked(timers[2]));
+  timer_list::iterator next = list.erase(list.iterator_to(timers[1]));
+  ASSERT_EQ(next->id, 3);
+  ASSERT_ANY_THROW(list.erase(list.end()));
+}
+
+TEST(intrusive_list_suit, already_linked) {
+  timer a;
+  timer_list list;
+  timer_list other;
+  list.push_back(a);
+  ASSERT_ANY_THROW(other.push_back(a));
+  list.clear();
+  ASSERT_FALSE(timer_list::is_linked(a));
+  other.push_back(a);
+  ASSERT_EQ(other.size(), 1U);
+}
+
+TEST(intrusive_list_suit, two_hooks) {
+  timer a(1, 0), b(2, 1);
+  timer_list all;
+  s21::intrusive_list<timer, &timer::expired_hook> expired;
+  all.push_back(a);
+  all.push_back(b);
+  expired.push_back(b);
+  ASSERT_EQ(&expired.front(), &b);
+  ASSERT_EQ(all.size(), 2U);
+  expired.clear();
+  ASSERT_EQ(ids(all), std::vector<int>({0, 1}));
+}
+
+TEST(intrusive_list_suit, splice) {
+  std::deque<timer> timers;
+  timer_list left;
+  timer_list right;
+  for (int i = 0; i < 6; i++) {
+    timers.emplace_back(i, i);
+    (i < 3 ? left : right).push_back(timers.back());
+  }
+  left.splice(left.begin(), right, right.iterator_to(timers[4]));
+  ASSERT_EQ(ids(left), std::vector<int>({4, 0, 1, 2}));
+  ASSERT_EQ(right.size(), 2U);
+  left.splice(left.end(), right);
+  ASSERT_TRUE(right.empty());
+  ASSERT_EQ(ids(left), std::vector<int>({4, 0, 1, 2, 3, 5}));
+  timer_list::iterator first = left.iterator_to(timers[0]);
+  timer_list::iterator last = left.iterator_to(timers[3]);
+  right.splice(right.end(), left, first, last);
+  ASSERT_EQ(ids(right), std::vector<int>({0, 1, 2}));
+  ASSERT_EQ(left.size(), 3U);
+  ASSERT_EQ(ids(left), std::vector<int>({4, 3, 5}));
+}
+
+TEST(intrusive_list_suit, sort_merge_unique) {
+  int deadlines[] = {5, 1, 4, 1, 5, 9, 2, 6};
+  std::deque<timer> timers;
+  timer_list list;
+  timer_list other;
+  for (int i = 0; i < 8; i++) {
+    timers.emplace_back(deadlines[i], i);
+    (i % 2 ? other : list).push_back(timers.back());
+  }
+  list.sort();
+  other.sort();
+  ASSERT_EQ(ids(list), std::vector<int>({6, 2, 0, 4}));
+  ASSERT_EQ(ids(other), std::vector<int>({1, 3, 7, 5}));
+  list.merge(other);
+  ASSERT_TRUE(other.empty());
+  ASSERT_EQ(list.size(), 8U);
+  ASSERT_EQ(ids(list), std::vector<int>({1, 3, 6, 2, 0, 4, 7, 5}));
+  list.unique();
+  ASSERT_EQ(ids(list), std::vector<int>({1, 6, 2, 0, 7, 5}));
+  ASSERT_FALSE(timer_list::is_linked(timers[3]));
+  list.reverse();
+  ASSERT_EQ(ids(list), std::vector<int>({5, 7, 0, 2, 6, 1}));
+  list.sort([](const timer& a, const timer& b) { return a.id < b.id; });
+  ASSERT_EQ(ids(list), std::vector<int>({0, 1, 2, 5, 6, 7}));
+}
+
+TEST(intrusive_list_suit, swap_move) {
+  timer a(1, 0), b(2, 1);
+  timer_list list;
+  list.push_back(a);
+  list.push_back(b);
+  timer_list moved(std::move(list));
+  ASSERT_TRUE(list.empty());
+  ASSERT_EQ(ids(moved), std::vector<int>({0, 1}));
+  timer_list other;
+  other.swap(moved);
+  ASSERT_TRUE(moved.empty());
+  other.pop_back();
+  ASSERT_EQ(&other.back(), &a);
+  list = std::move(other);
+  ASSERT_EQ(list.size(), 1U);
+  ASSERT_EQ((--list.end())->id, 0);
+}
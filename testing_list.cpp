@@ -1,8 +1,19 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <iostream>
 #include <iterator>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <limits>
 #include <list>
+#include <memory>
+#include <memory_resource>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 #include "s21_list.h"
 
@@ -235,9 +246,12 @@ TEST(list_function_suit, insert) {
 
 TEST(list_function_suit, erase_back) {
   s21::list<int> s21list{1, 3};
-  s21::list<int> stdlist{1, 3};
+  std::list<int> stdlist{1, 3};
   s21::list<int>::iterator s21it = s21list.end();
-  s21::list<int>::iterator stdit = stdlist.end();
+  std::list<int>::iterator stdit = stdlist.end();
+  ASSERT_ANY_THROW(s21list.erase(s21it));
+  --s21it;
+  --stdit;
   s21list.erase(s21it);
   stdlist.erase(stdit);
   ASSERT_EQ(s21list.front(), stdlist.front());
@@ -316,7 +330,7 @@ TEST(list_function_suit, merge) {
   stdlist.merge(stdlist2);
   s21::list<int>::iterator s21it = s21list.begin();
   std::list<int>::iterator stdit = stdlist.begin();
-  ASSERT_EQ(s21list.size() + 2, stdlist.size());
+  ASSERT_EQ(s21list.size(), stdlist.size());
   ASSERT_EQ(s21list2.size(), stdlist2.size());
   for (size_t i = 0; i < s21list.size(); i++) {
     ASSERT_EQ(*s21it, *stdit);
@@ -335,7 +349,7 @@ TEST(list_function_suit, merge_2) {
   stdlist.merge(stdlist2);
   s21::list<int>::iterator s21it = s21list.begin();
   std::list<int>::iterator stdit = stdlist.begin();
-  ASSERT_EQ(s21list.size() + 5, stdlist.size());
+  ASSERT_EQ(s21list.size(), stdlist.size());
   ASSERT_EQ(s21list2.size(), stdlist2.size());
   for (size_t i = 0; i < s21list.size(); i++) {
     ASSERT_EQ(*s21it, *stdit);
@@ -345,6 +359,57 @@ TEST(list_function_suit, merge_2) {
   ASSERT_EQ(s21list2.empty(), stdlist2.empty());
 }
 
+TEST(list_function_suit, merge_comparator) {
+  using item = std::pair<int, int>;
+  auto by_key = [](const item& a, const item& b) { return a.first > b.first; };
+  s21::list<item> s21list{{9, 0}, {5, 1}, {5, 2}, {1, 3}};
+  s21::list<item> s21list2{{7, 4}, {5, 5}, {0, 6}};
+  std::list<item> stdlist{{9, 0}, {5, 1}, {5, 2}, {1, 3}};
+  std::list<item> stdlist2{{7, 4}, {5, 5}, {0, 6}};
+  s21list.merge(s21list2, by_key);
+  stdlist.merge(stdlist2, by_key);
+  ASSERT_EQ(s21list.size(), stdlist.size());
+  ASSERT_TRUE(s21list2.empty());
+  s21::list<item>::iterator s21it = s21list.begin();
+  std::list<item>::iterator stdit = stdlist.begin();
+  for (size_t i = 0; i < s21list.size(); i++) {
+    ASSERT_EQ(*s21it, *stdit);
+    ++s21it;
+    ++stdit;
+  }
+  ASSERT_EQ(s21list.back(), stdlist.back());
+  s21list.push_back({-1, 7});
+  ASSERT_EQ(s21list.back(), item(-1, 7));
+}
+
+TEST(list_function_suit, merge_self_and_no_default_ctor) {
+  struct key {
+    explicit key(int v) : value(v) {}
+    bool operator<(const key& other) const { return value < other.value; }
+    int value;
+  };
+  s21::list<key> s21list;
+  s21::list<key> s21list2;
+  for (int i = 0; i < 6; i++) (i % 2 ? s21list : s21list2).emplace_back(i);
+  s21list.merge(s21list);
+  ASSERT_EQ(s21list.size(), 3U);
+  s21list.merge(s21list2);
+  ASSERT_EQ(s21list.size(), 6U);
+  ASSERT_TRUE(s21list2.empty());
+  int expected = 0;
+  for (const key& k : s21list) ASSERT_EQ(k.value, expected++);
+}
+
+TEST(list_function_suit, merge_long) {
+  s21::list<int> s21list;
+  s21::list<int> s21list2;
+  for (int i = 0; i < 1000000; i++) (i % 3 ? s21list : s21list2).push_back(i);
+  s21list.merge(s21list2);
+  ASSERT_EQ(s21list.size(), 1000000U);
+  int expected = 0;
+  for (int value : s21list) ASSERT_EQ(value, expected++);
+}
+
 TEST(list_function_suit, splice) {
   s21::list<int> s21list{66, 44, 0, 97, 2142};
   s21::list<int> s21list2{5, 3};
@@ -366,6 +431,122 @@ TEST(list_function_suit, splice) {
   ASSERT_EQ(s21list2.empty(), stdlist2.empty());
 }
 
+TEST(list_function_suit, splice_middle_keeps_nodes) {
+  s21::list<int> s21list{66, 44, 0, 97, 2142};
+  s21::list<int> s21list2{5, 3};
+  std::list<int> stdlist{66, 44, 0, 97, 2142};
+  std::list<int> stdlist2{5, 3};
+  s21::list<int>::iterator moved = s21list2.begin();
+  s21::list<int>::iterator s21it = s21list.begin();
+  std::list<int>::iterator stdit = stdlist.begin();
+  ++s21it;
+  ++stdit;
+  s21list.splice(s21it, s21list2);
+  stdlist.splice(stdit, stdlist2);
+  ASSERT_EQ(*moved, 5);
+  ++moved;
+  ++moved;
+  ASSERT_EQ(*moved, 44);
+  ASSERT_TRUE(s21list2.empty());
+  ASSERT_EQ(s21list.size(), stdlist.size());
+  s21it = s21list.begin();
+  stdit = stdlist.begin();
+  for (size_t i = 0; i < s21list.size(); i++) {
+    ASSERT_EQ(*s21it, *stdit);
+    ++s21it;
+    ++stdit;
+  }
+}
+
+TEST(list_function_suit, splice_element) {
+  s21::list<int> s21list{66, 44, 0, 97, 2142};
+  s21::list<int> s21list2{5, 3, 8};
+  std::list<int> stdlist{66, 44, 0, 97, 2142};
+  std::list<int> stdlist2{5, 3, 8};
+  s21::list<int>::iterator s21from = s21list2.begin();
+  std::list<int>::iterator stdfrom = stdlist2.begin();
+  ++s21from;
+  ++stdfrom;
+  s21list.splice(s21list.begin(), s21list2, s21from);
+  stdlist.splice(stdlist.begin(), stdlist2, stdfrom);
+  s21from = s21list.begin();
+  stdfrom = stdlist.begin();
+  for (int i = 0; i < 3; i++) ++s21from;
+  for (int i = 0; i < 3; i++) ++stdfrom;
+  s21list.splice(s21list.begin(), s21list, s21from);
+  stdlist.splice(stdlist.begin(), stdlist, stdfrom);
+  ASSERT_EQ(s21list.size(), stdlist.size());
+  ASSERT_EQ(s21list2.size(), stdlist2.size());
+  ASSERT_EQ(s21list2.front(), stdlist2.front());
+  ASSERT_EQ(s21list2.back(), stdlist2.back());
+  s21::list<int>::iterator s21it = s21list.begin();
+  std::list<int>::iterator stdit = stdlist.begin();
+  for (size_t i = 0; i < s21list.size(); i++) {
+    ASSERT_EQ(*s21it, *stdit);
+    ++s21it;
+    ++stdit;
+  }
+}
+
+TEST(list_function_suit, splice_range) {
+  s21::list<int> s21list{66, 44, 0, 97, 2142};
+  s21::list<int> s21list2{5, 3, 8, 13, 21};
+  std::list<int> stdlist{66, 44, 0, 97, 2142};
+  std::list<int> stdlist2{5, 3, 8, 13, 21};
+  s21::list<int>::iterator s21first = s21list2.begin();
+  s21::list<int>::iterator s21last = s21list2.begin();
+  std::list<int>::iterator stdfirst = stdlist2.begin();
+  std::list<int>::iterator stdlast = stdlist2.begin();
+  ++s21first;
+  ++stdfirst;
+  for (int i = 0; i < 4; i++) ++s21last;
+  for (int i = 0; i < 4; i++) ++stdlast;
+  s21::list<int>::iterator s21it = s21list.begin();
+  std::list<int>::iterator stdit = stdlist.begin();
+  ++s21it;
+  ++stdit;
+  s21list.splice(s21it, s21list2, s21first, s21last);
+  stdlist.splice(stdit, stdlist2, stdfirst, stdlast);
+  ASSERT_EQ(s21list.size(), stdlist.size());
+  ASSERT_EQ(s21list2.size(), stdlist2.size());
+  ASSERT_EQ(s21list2.front(), stdlist2.front());
+  ASSERT_EQ(s21list2.back(), stdlist2.back());
+  s21it = s21list.begin();
+  stdit = stdlist.begin();
+  for (size_t i = 0; i < s21list.size(); i++) {
+    ASSERT_EQ(*s21it, *stdit);
+    ++s21it;
+    ++stdit;
+  }
+}
+
+TEST(list_function_suit, splice_unequal_allocators) {
+  using pool_list =
+      s21::list<std::string, s21::node_pool_allocator<std::string>>;
+  pool_list s21list{"aannemar", "rdontos"};
+  pool_list s21list2{"tsherman", "john"};
+  s21list.splice(s21list.begin(), s21list2);
+  ASSERT_TRUE(s21list2.empty());
+  ASSERT_EQ(s21list.size(), 4U);
+  ASSERT_EQ(s21list.front(), "tsherman");
+  s21list2.push_back("oleg");
+  ASSERT_EQ(s21list2.front(), "oleg");
+}
+
+TEST(list_function_suit, merge_unequal_allocators) {
+  using pool_list =
+      s21::list<std::string, s21::node_pool_allocator<std::string>>;
+  pool_list s21list{"aannemar", "rdontos", "tsherman"};
+  pool_list s21list2{"john", "oleg", "zed"};
+  s21list.merge(s21list2);
+  ASSERT_TRUE(s21list2.empty());
+  std::list<std::string> expected{"aannemar", "john",     "oleg",
+                                  "rdontos",  "tsherman", "zed"};
+  ASSERT_EQ(s21list.size(), expected.size());
+  std::list<std::string>::iterator stdit = expected.begin();
+  for (const std::string& item : s21list) ASSERT_EQ(item, *stdit++);
+}
+
 TEST(list_function_suit, reverse) {
   s21::list<int> s21list{66, 44, 0, 97, 2142};
   std::list<int> stdlist{66, 44, 0, 97, 2142};
@@ -383,7 +564,8 @@ TEST(list_function_suit, reverse) {
 
 TEST(list_function_suit, unique_empty) {
   s21::list<int> s21list;
-  ASSERT_ANY_THROW(s21list.unique());
+  s21list.unique();
+  ASSERT_TRUE(s21list.empty());
 }
 
 TEST(list_function_suit, unique) {
@@ -401,13 +583,72 @@ TEST(list_function_suit, unique) {
   }
 }
 
+TEST(list_function_suit, unique_predicate) {
+  s21::list<int> s21list{1, 2, 4, 5, 7, 10, 11, 12};
+  std::list<int> stdlist{1, 2, 4, 5, 7, 10, 11, 12};
+  auto close = [](int kept, int next) { return next - kept < 3; };
+  s21list.unique(close);
+  stdlist.unique(close);
+  ASSERT_TRUE(std::equal(s21list.begin(), s21list.end(), stdlist.begin(),
+                         stdlist.end()));
+}
+
+TEST(list_function_suit, remove) {
+  s21::list<int> s21list{3, 1, 3, 3, 2, 3};
+  s21list.remove(3);
+  ASSERT_EQ(std::vector<int>(s21list.begin(), s21list.end()),
+            std::vector<int>({1, 2}));
+  // The value may live in the list itself
+  s21::list<int> self{5, 1, 5, 2};
+  self.remove(self.front());
+  ASSERT_EQ(std::vector<int>(self.begin(), self.end()),
+            std::vector<int>({1, 2}));
+  s21::list<int> empty;
+  empty.remove(1);
+  ASSERT_TRUE(empty.empty());
+}
+
+TEST(list_function_suit, remove_if) {
+  s21::list<std::string> s21list{"a", "bb", "", "ccc", "dd"};
+  s21list.remove_if([](const std::string& s) { return s.size() % 2 == 0; });
+  ASSERT_EQ(std::vector<std::string>(s21list.begin(), s21list.end()),
+            std::vector<std::string>({"a", "ccc"}));
+  ASSERT_EQ(s21list.size(), 2U);
+  // A throwing predicate keeps what it has removed so far
+  s21::list<int> numbers{1, 2, 3, 4};
+  ASSERT_ANY_THROW(numbers.remove_if([](int x) {
+    if (x == 3) throw "stop";
+    return x == 1;
+  }));
+  ASSERT_EQ(std::vector<int>(numbers.begin(), numbers.end()),
+            std::vector<int>({2, 3, 4}));
+}
+
+TEST(list_function_suit, dedupe) {
+  s21::list<int> s21list{4, 1, 4, 2, 1, 1, 3, 2, 4};
+  s21list.dedupe();
+  ASSERT_EQ(std::vector<int>(s21list.begin(), s21list.end()),
+            std::vector<int>({4, 1, 2, 3}));
+  ASSERT_EQ(s21list.size(), 4U);
+  s21::list<std::string> words{"b", "a", "b", "c", "a"};
+  words.dedupe();
+  ASSERT_EQ(std::vector<std::string>(words.begin(), words.end()),
+            std::vector<std::string>({"b", "a", "c"}));
+  // Collisions in every slot still compare with equal
+  s21::list<int> collide;
+  for (int i = 0; i < 100; i++) collide.push_back(i % 10);
+  collide.dedupe([](int) { return std::size_t(7); });
+  ASSERT_EQ(collide.size(), 10U);
+  ASSERT_EQ(collide.back(), 9);
+}
+
 TEST(list_sort_suit, sort) {
   s21::list<int> s21list{66, 44, 0, 97, 2142};
   std::list<int> stdlist{66, 44, 0, 97, 2142};
 
   s21::list<int>::iterator s21it = s21list.begin();
   for (size_t i = 0; i < s21list.size(); i++) {
-    std::cout << s21it.n_current->data << std::endl;
+    std::cout << *s21it << std::endl;
   }
   s21list.sort();
   stdlist.sort();
@@ -418,7 +659,118 @@ TEST(list_sort_suit, sort) {
   s21it = s21list.begin();
   ASSERT_EQ(s21list.size(), stdlist.size());
   for (size_t i = 0; i < s21list.size(); i++) {
-    std::cout << s21it.n_current->data << std::endl;
+    std::cout << *s21it << std::endl;
+    ASSERT_EQ(*s21it, *stdit);
+    ++s21it;
+    ++stdit;
+  }
+}
+
+TEST(list_sort_suit, sort_comparator) {
+  s21::list<int> s21list{66, 44, 0, 97, 2142, 44};
+  std::list<int> stdlist{66, 44, 0, 97, 2142, 44};
+  s21list.sort(std::greater<int>());
+  stdlist.sort(std::greater<int>());
+  ASSERT_EQ(s21list.size(), stdlist.size());
+  ASSERT_EQ(s21list.front(), stdlist.front());
+  ASSERT_EQ(s21list.back(), stdlist.back());
+  s21::list<int>::iterator s21it = s21list.begin();
+  std::list<int>::iterator stdit = stdlist.begin();
+  for (size_t i = 0; i < s21list.size(); i++) {
+    ASSERT_EQ(*s21it, *stdit);
+    ++s21it;
+    ++stdit;
+  }
+}
+
+TEST(list_sort_suit, sort_stable) {
+  using item = std::pair<int, int>;
+  auto by_key = [](const item& a, const item& b) { return a.first < b.first; };
+  s21::list<item> s21list;
+  std::list<item> stdlist;
+  for (int i = 0; i < 1000; i++) {
+    s21list.push_back({(i * 7919) % 13, i});
+    stdlist.push_back({(i * 7919) % 13, i});
+  }
+  s21list.sort(by_key);
+  stdlist.sort(by_key);
+  ASSERT_EQ(s21list.size(), stdlist.size());
+  ASSERT_EQ(s21list.back(), stdlist.back());
+  s21::list<item>::iterator s21it = s21list.begin();
+  std::list<item>::iterator stdit = stdlist.begin();
+  for (size_t i = 0; i < s21list.size(); i++) {
+    ASSERT_EQ(*s21it, *stdit);
+    ++s21it;
+    ++stdit;
+  }
+}
+
+TEST(list_sort_suit, sort_large) {
+  s21::list<int> s21list;
+  std::list<int> stdlist;
+  unsigned seed = 42;
+  for (int i = 0; i < 100000; i++) {
+    seed = seed * 1103515245 + 12345;
+    s21list.push_back(static_cast<int>(seed >> 8));
+    stdlist.push_back(static_cast<int>(seed >> 8));
+  }
+  s21list.sort();
+  stdlist.sort();
+  ASSERT_EQ(s21list.size(), stdlist.size());
+  ASSERT_EQ(s21list.front(), stdlist.front());
+  ASSERT_EQ(s21list.back(), stdlist.back());
+  s21::list<int>::iterator s21it = s21list.begin();
+  std::list<int>::iterator stdit = stdlist.begin();
+  for (size_t i = 0; i < s21list.size(); i++) {
+    ASSERT_EQ(*s21it, *stdit);
+    ++s21it;
+    ++stdit;
+  }
+  s21it = s21list.end();
+  s21it--;
+  ASSERT_EQ(*s21it, *std::prev(stdlist.end()));
+}
+
+TEST(list_sort_suit, sort_parallel) {
+  for (unsigned threads : {0u, 1u, 2u, 3u, 8u}) {
+    s21::list<int> s21list;
+    std::list<int> stdlist;
+    unsigned seed = threads;
+    for (int i = 0; i < 100003; i++) {
+      seed = seed * 1103515245 + 12345;
+      s21list.push_back(static_cast<int>(seed >> 8));
+      stdlist.push_back(static_cast<int>(seed >> 8));
+    }
+    s21list.sort(s21::execution::par.with_threads(threads));
+    stdlist.sort();
+    ASSERT_EQ(s21list.size(), stdlist.size());
+    s21::list<int>::iterator s21it = s21list.begin();
+    std::list<int>::iterator stdit = stdlist.begin();
+    for (size_t i = 0; i < s21list.size(); i++) {
+      ASSERT_EQ(*s21it, *stdit);
+      ++s21it;
+      ++stdit;
+    }
+    s21it = s21list.end();
+    s21it--;
+    ASSERT_EQ(*s21it, *std::prev(stdlist.end()));
+  }
+}
+
+TEST(list_sort_suit, sort_parallel_stable) {
+  using item = std::pair<int, int>;
+  auto by_key = [](const item& a, const item& b) { return a.first < b.first; };
+  s21::list<item> s21list;
+  std::list<item> stdlist;
+  for (int i = 0; i < 50000; i++) {
+    s21list.push_back({(i * 7919) % 13, i});
+    stdlist.push_back({(i * 7919) % 13, i});
+  }
+  s21list.sort(s21::execution::par.with_threads(4), by_key);
+  stdlist.sort(by_key);
+  s21::list<item>::iterator s21it = s21list.begin();
+  std::list<item>::iterator stdit = stdlist.begin();
+  for (size_t i = 0; i < s21list.size(); i++) {
     ASSERT_EQ(*s21it, *stdit);
     ++s21it;
     ++stdit;
@@ -430,7 +782,6 @@ TEST(list_iter_suit, iter_end) {
   std::list<int> stdlist{66, 44, 0, 97, 2142};
   s21::list<int>::iterator s21it = s21list.end();
   std::list<int>::iterator stdit = stdlist.end();
-  stdit--;
   for (size_t i = 0; i < 2; i++) {
     s21it--;
     stdit--;
@@ -438,6 +789,112 @@ TEST(list_iter_suit, iter_end) {
   }
 }
 
+TEST(list_iter_suit, range_for) {
+  s21::list<int> s21list{66, 44, 0, 97, 2142};
+  std::list<int> stdlist{66, 44, 0, 97, 2142};
+  std::list<int>::iterator stdit = stdlist.begin();
+  size_t visited = 0;
+  for (int value : s21list) {
+    ASSERT_EQ(value, *stdit);
+    ++stdit;
+    visited++;
+  }
+  ASSERT_EQ(visited, stdlist.size());
+  s21::list<int> empty;
+  ASSERT_TRUE(empty.begin() == empty.end());
+}
+
+TEST(list_iter_suit, insert_erase_end) {
+  s21::list<int> s21list;
+  std::list<int> stdlist;
+  s21::list<int>::iterator s21it = s21list.insert(s21list.end(), 1);
+  ASSERT_EQ(s21list.size(), 1U);
+  ASSERT_EQ(*s21it, 1);
+  s21list.insert(s21list.end(), 2);
+  s21list.insert(s21list.begin(), 0);
+  stdlist.insert(stdlist.end(), 1);
+  stdlist.insert(stdlist.end(), 2);
+  stdlist.insert(stdlist.begin(), 0);
+  ASSERT_EQ(s21list.back(), stdlist.back());
+  s21it = s21list.begin();
+  while (s21it != s21list.end()) {
+    s21::list<int>::iterator next = s21it;
+    ++next;
+    s21list.erase(s21it);
+    s21it = next;
+  }
+  ASSERT_TRUE(s21list.empty());
+  ASSERT_TRUE(s21list.begin() == s21list.end());
+}
+
+TEST(list_iter_suit, reverse_tail) {
+  s21::list<int> s21list{66, 44, 0};
+  std::list<int> stdlist{66, 44, 0};
+  s21list.reverse();
+  stdlist.reverse();
+  ASSERT_EQ(s21list.back(), stdlist.back());
+  s21list.push_back(5);
+  stdlist.push_back(5);
+  s21::list<int>::iterator s21it = s21list.begin();
+  std::list<int>::iterator stdit = stdlist.begin();
+  for (size_t i = 0; i < s21list.size(); i++) {
+    ASSERT_EQ(*s21it, *stdit);
+    ++s21it;
+    ++stdit;
+  }
+  ASSERT_TRUE(s21it == s21list.end());
+}
+
+TEST(list_iter_suit, reverse_iterators) {
+  s21::list<int> s21list{66, 44, 0, 97, 2142};
+  std::list<int> stdlist{66, 44, 0, 97, 2142};
+  std::list<int>::reverse_iterator stdit = stdlist.rbegin();
+  for (s21::list<int>::reverse_iterator it = s21list.rbegin();
+       it != s21list.rend(); ++it, ++stdit) {
+    ASSERT_EQ(*it, *stdit);
+  }
+  ASSERT_TRUE(stdit == stdlist.rend());
+  *s21list.rbegin() = 1;
+  ASSERT_EQ(s21list.back(), 1);
+  const s21::list<int>& view = s21list;
+  s21::list<int>::const_reverse_iterator last = view.rend();
+  ASSERT_EQ(*--last, 66);
+  s21::list<int> empty;
+  ASSERT_TRUE(empty.rbegin() == empty.rend());
+}
+
+TEST(list_iter_suit, reversed_view) {
+  s21::list<int> s21list{66, 44, 0, 97, 2142};
+  std::vector<int> seen;
+  for (int& value : s21list.reversed()) seen.push_back(value++);
+  ASSERT_EQ(seen, std::vector<int>({2142, 97, 0, 44, 66}));
+  ASSERT_EQ(s21list.front(), 67);
+  seen.clear();
+  const s21::list<int>& view = s21list;
+  for (const int& value : view.reversed()) seen.push_back(value);
+  ASSERT_EQ(seen, std::vector<int>({2143, 98, 1, 45, 67}));
+}
+
+TEST(list_iter_suit, const_iterator) {
+  using list = s21::list<int>;
+  static_assert(std::is_convertible_v<list::iterator, list::const_iterator>);
+  static_assert(
+      !std::is_convertible_v<list::const_iterator, list::iterator>);
+  static_assert(
+      std::is_same_v<decltype(*std::declval<list::const_iterator>()),
+                     const int&>);
+  list s21list{1, 2, 3};
+  list::const_iterator it = s21list.begin();
+  ++it;
+  ASSERT_EQ(*it--, 2);
+  ASSERT_TRUE(it == s21list.begin());
+  ASSERT_TRUE(s21list.begin() == it);
+  ASSERT_TRUE(it != s21list.end());
+  s21list.insert(++it, 5);
+  ASSERT_EQ(std::vector<int>(s21list.begin(), s21list.end()),
+            std::vector<int>({1, 5, 2, 3}));
+}
+
 TEST(list_iter_suit, iter) {
   s21::list<int> s21list{66, 44, 0, 97, 2142};
   s21::list<int>::iterator begin = s21list.begin();
@@ -495,6 +952,1098 @@ TEST(bonus_suit, emplace_front) {
   }
 }
 
+struct copy_counter {
+  static inline int copies = 0;
+  int value;
+  explicit copy_counter(int v) : value(v) {}
+  copy_counter(int a, int b) : value(a * b) {}
+  copy_counter(const copy_counter& other) : value(other.value) { copies++; }
+  copy_counter(copy_counter&& other) noexcept : value(other.value) {}
+  copy_counter& operator=(const copy_counter& other) {
+    value = other.value;
+    copies++;
+    return *this;
+  }
+  copy_counter& operator=(copy_counter&& other) noexcept {
+    value = other.value;
+    return *this;
+  }
+};
+
+TEST(bonus_suit, emplace_in_place) {
+  copy_counter::copies = 0;
+  s21::list<copy_counter> s21list;
+  s21list.emplace_back(2, 3);
+  s21list.emplace_front(7);
+  s21::list<copy_counter>::iterator s21it = s21list.end();
+  s21list.emplace(s21it, 4, 5);
+  s21list.emplace(s21list.begin(), 1);
+  ASSERT_EQ(copy_counter::copies, 0);
+  ASSERT_EQ(s21list.size(), 4U);
+  ASSERT_EQ(s21list.front().value, 1);
+  ASSERT_EQ(s21list.back().value, 20);
+}
+
+TEST(bonus_suit, push_rvalue) {
+  copy_counter::copies = 0;
+  s21::list<copy_counter> s21list;
+  s21list.push_back(copy_counter(1));
+  s21list.push_front(copy_counter(2));
+  copy_counter value(3);
+  s21list.insert(s21list.begin(), std::move(value));
+  ASSERT_EQ(copy_counter::copies, 0);
+  s21list.push_back(value);
+  ASSERT_EQ(copy_counter::copies, 1);
+  ASSERT_EQ(s21list.size(), 4U);
+  ASSERT_EQ(s21list.front().value, 3);
+}
+
+TEST(bonus_suit, emplace_string) {
+  s21::list<std::string> s21list;
+  std::list<std::string> stdlist;
+  s21list.emplace_back(3, 'a');
+  stdlist.emplace_back(3, 'a');
+  s21list.emplace_front("rdontos");
+  stdlist.emplace_front("rdontos");
+  std::string moved = "tsherman";
+  s21list.push_back(std::move(moved));
+  stdlist.push_back("tsherman");
+  s21::list<std::string>::iterator s21it = s21list.begin();
+  std::list<std::string>::iterator stdit = stdlist.begin();
+  ASSERT_EQ(s21list.size(), stdlist.size());
+  for (size_t i = 0; i < s21list.size(); i++) {
+    ASSERT_EQ(*s21it, *stdit);
+    ++s21it;
+    ++stdit;
+  }
+}
+
+struct allocation_counter {
+  static inline int live = 0;
+};
+
+template <typename T>
+struct counting_allocator : allocation_counter {
+  using value_type = T;
+  counting_allocator() = default;
+  template <typename U>
+  counting_allocator(const counting_allocator<U>&) {}
+  T* allocate(size_t n) {
+    live += static_cast<int>(n);
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T* p, size_t n) {
+    live -= static_cast<int>(n);
+    std::allocator<T>().deallocate(p, n);
+  }
+  template <typename U>
+  bool operator==(const counting_allocator<U>&) const {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(const counting_allocator<U>&) const {
+    return false;
+  }
+};
+
+TEST(list_allocator_suit, custom_allocator) {
+  using alloc = counting_allocator<int>;
+  {
+    s21::list<int, alloc> s21list{66, 44, 0, 97};
+    s21list.push_front(1);
+    s21list.pop_back();
+    ASSERT_EQ(alloc::live, 4);
+    s21::list<int, alloc> s21list2(s21list);
+    ASSERT_EQ(alloc::live, 8);
+    s21list2.clear();
+    ASSERT_EQ(alloc::live, 4);
+  }
+  ASSERT_EQ(alloc::live, 0);
+}
+
+TEST(list_allocator_suit, pool_allocator) {
+  using pool_list = s21::list<int, s21::node_pool_allocator<int>>;
+  pool_list s21list;
+  std::list<int> stdlist;
+  for (int i = 0; i < 1000; i++) {
+    s21list.push_back(i);
+    stdlist.push_back(i);
+  }
+  for (int i = 0; i < 500; i++) {
+    s21list.pop_front();
+    stdlist.pop_front();
+  }
+  for (int i = 0; i < 300; i++) {
+    s21list.push_front(-i);
+    stdlist.push_front(-i);
+  }
+  s21list.sort();
+  stdlist.sort();
+  ASSERT_EQ(s21list.size(), stdlist.size());
+  pool_list::iterator s21it = s21list.begin();
+  std::list<int>::iterator stdit = stdlist.begin();
+  for (size_t i = 0; i < s21list.size(); i++) {
+    ASSERT_EQ(*s21it, *stdit);
+    ++s21it;
+    ++stdit;
+  }
+}
+
+TEST(list_allocator_suit, pool_allocator_copy_swap) {
+  using pool_list = s21::list<int, s21::node_pool_allocator<int>>;
+  pool_list s21list{1, 2, 3};
+  pool_list s21list2(s21list);
+  ASSERT_TRUE(s21list.get_allocator() != s21list2.get_allocator());
+  s21list2.push_back(4);
+  s21list.swap(s21list2);
+  ASSERT_EQ(s21list.size(), 4U);
+  ASSERT_EQ(s21list.back(), 4);
+  ASSERT_EQ(s21list2.back(), 3);
+  pool_list s21list3 = std::move(s21list);
+  ASSERT_EQ(s21list3.size(), 4U);
+  ASSERT_TRUE(s21list.empty());
+  s21list3.clear();
+  ASSERT_TRUE(s21list3.empty());
+  s21list3.push_back(7);
+  ASSERT_EQ(s21list3.front(), 7);
+}
+
+TEST(list_allocator_suit, pool_allocator_shared_clear) {
+  s21::node_pool_allocator<std::string> pool;
+  s21::list<std::string, s21::node_pool_allocator<std::string>> s21list(
+      pool);
+  s21::list<std::string, s21::node_pool_allocator<std::string>> s21list2(
+      pool);
+  s21list.push_back("aannemar");
+  s21list2.push_back("rdontos");
+  s21list.clear();
+  s21list.push_back("tsherman");
+  ASSERT_EQ(s21list.front(), "tsherman");
+  ASSERT_EQ(s21list2.front(), "rdontos");
+}
+
+struct live_counter {
+  static inline int live = 0;
+  int value;
+  explicit live_counter(int v) : value(v) { live++; }
+  live_counter(const live_counter& other) : value(other.value) { live++; }
+  ~live_counter() { live--; }
+};
+
+// Whether every node of list sits at one of addresses
+template <typename List>
+bool nodes_among(const List& list, const std::vector<const void*>& addresses) {
+  for (const auto& value : list) {
+    if (std::find(addresses.begin(), addresses.end(), &value) ==
+        addresses.end()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+TEST(list_allocator_suit, pool_clear_exclusive) {
+  using pool_list =
+      s21::list<int, s21::node_pool_allocator<int>, s21::counting_stats>;
+  pool_list s21list;
+  s21list.get_allocator().set_compact_ratio(0.5);
+  for (int i = 0; i < 100; i++) s21list.push_back(i);
+  for (int i = 0; i < 20; i++) s21list.pop_front();
+  for (int i = 0; i < 20; i++) s21list.push_back(i);
+  s21list.clear();
+  ASSERT_TRUE(s21list.empty());
+  ASSERT_EQ(s21list.stats().frees, 120U);
+  // The pool dropped its chunks: refilling reuses no freed block
+  for (int i = 0; i < 100; i++) s21list.push_back(i);
+  ASSERT_FALSE(s21list.get_allocator().wants_compact(s21list.size()));
+  ASSERT_EQ(s21list.back(), 99);
+
+  live_counter::live = 0;
+  {
+    s21::list<live_counter, s21::node_pool_allocator<live_counter>> counted;
+    for (int i = 0; i < 50; i++) counted.emplace_back(i);
+    std::vector<const void*> addresses;
+    for (const live_counter& item : counted) addresses.push_back(&item);
+    counted.clear();
+    ASSERT_EQ(live_counter::live, 0);
+    for (int i = 0; i < 50; i++) counted.emplace_back(i);
+    ASSERT_TRUE(nodes_among(counted, addresses));
+  }
+  ASSERT_EQ(live_counter::live, 0);
+}
+
+TEST(list_allocator_suit, pool_clear_shared) {
+  s21::node_pool_allocator<int> pool;
+  pool.set_compact_ratio(0.5);
+  s21::list<int, s21::node_pool_allocator<int>> s21list(pool);
+  s21::list<int, s21::node_pool_allocator<int>> neighbour(pool);
+  neighbour.push_back(-1);
+  for (int i = 0; i < 100; i++) s21list.push_back(i);
+  std::vector<const void*> addresses;
+  for (const int& value : s21list) addresses.push_back(&value);
+  s21list.clear();
+  ASSERT_TRUE(s21list.empty());
+  ASSERT_EQ(neighbour.front(), -1);
+  // Every node went back to the shared pool and is handed out again
+  for (int i = 0; i < 100; i++) s21list.push_back(i);
+  ASSERT_TRUE(nodes_among(s21list, addresses));
+  ASSERT_TRUE(pool.wants_compact(s21list.size()));
+
+  live_counter::live = 0;
+  s21::node_pool_allocator<live_counter> counted_pool;
+  s21::list<live_counter, s21::node_pool_allocator<live_counter>> counted(
+      counted_pool);
+  for (int i = 0; i < 50; i++) counted.emplace_back(i);
+  counted.clear();
+  ASSERT_EQ(live_counter::live, 0);
+}
+
+TEST(list_bulk_suit, range_constructor) {
+  std::vector<std::string> source{"aannemar", "rdontos", "tsherman"};
+  s21::list<std::string> s21list(source.begin(), source.end());
+  s21::list<int> s21list2(3, 7);
+  std::list<int> stdlist(3, 7);
+  ASSERT_EQ(s21list.size(), 3U);
+  ASSERT_EQ(s21list.front(), "aannemar");
+  ASSERT_EQ(s21list.back(), "tsherman");
+  ASSERT_EQ(s21list2.size(), stdlist.size());
+  for (int value : s21list2) ASSERT_EQ(value, 7);
+  s21::list<int> s21list3(stdlist.begin(), stdlist.begin());
+  ASSERT_TRUE(s21list3.empty());
+  s21list3.push_back(1);
+  ASSERT_EQ(s21list3.back(), 1);
+}
+
+TEST(list_bulk_suit, insert_range) {
+  s21::list<int> s21list{1, 5};
+  std::list<int> stdlist{1, 5};
+  std::vector<int> source{2, 3, 4};
+  s21::list<int>::iterator s21it = s21list.insert(
+      ++s21list.begin(), source.begin(), source.end());
+  stdlist.insert(++stdlist.begin(), source.begin(), source.end());
+  ASSERT_EQ(*s21it, 2);
+  s21list.insert(s21list.end(), 2, 6);
+  stdlist.insert(stdlist.end(), 2, 6);
+  s21list.insert(s21list.begin(), {-1, 0});
+  stdlist.insert(stdlist.begin(), {-1, 0});
+  s21it = s21list.insert(s21list.begin(), source.end(), source.end());
+  ASSERT_EQ(*s21it, -1);
+  ASSERT_EQ(s21list.size(), stdlist.size());
+  s21it = s21list.begin();
+  for (int value : stdlist) ASSERT_EQ(*s21it++, value);
+  ASSERT_EQ(*--s21list.end(), 6);
+}
+
+TEST(list_bulk_suit, assign) {
+  s21::list<int> s21list{1, 2, 3};
+  s21list.assign(4, 9);
+  ASSERT_EQ(s21list.size(), 4U);
+  for (int value : s21list) ASSERT_EQ(value, 9);
+  s21list.assign({5, 6});
+  ASSERT_EQ(s21list.size(), 2U);
+  ASSERT_EQ(s21list.front(), 5);
+  ASSERT_EQ(s21list.back(), 6);
+  std::list<int> source{7, 8, 9};
+  s21list.assign(source.begin(), source.end());
+  ASSERT_EQ(s21list.size(), 3U);
+  ASSERT_EQ(s21list.back(), 9);
+}
+
+struct throwing_copy {
+  static inline int copies_left = 0;
+  int value;
+  explicit throwing_copy(int v) : value(v) {}
+  throwing_copy(const throwing_copy& other) : value(other.value) { count(); }
+  throwing_copy& operator=(const throwing_copy& other) {
+    count();
+    value = other.value;
+    return *this;
+  }
+  static void count() {
+    if (copies_left-- == 0) throw std::runtime_error("copy");
+  }
+};
+
+TEST(list_bulk_suit, strong_guarantee) {
+  using alloc = counting_allocator<throwing_copy>;
+  throwing_copy::copies_left = 100;
+  std::vector<throwing_copy> source;
+  for (int i = 0; i < 5; i++) source.emplace_back(i);
+  s21::list<throwing_copy, alloc> s21list(source.begin(), source.begin() + 2);
+  s21::list<throwing_copy, alloc> s21list2(source.begin(), source.end());
+  int live = allocation_counter::live;
+  throwing_copy::copies_left = 3;
+  ASSERT_THROW(s21list.insert(s21list.end(), source.begin(), source.end()),
+               std::runtime_error);
+  ASSERT_EQ(allocation_counter::live, live);
+  ASSERT_EQ(s21list.size(), 2U);
+  ASSERT_EQ(s21list.front().value, 0);
+  ASSERT_EQ(s21list.back().value, 1);
+}
+
+// Assignment overwrites nodes in place: a throwing copy leaves a valid list
+// of the old size and leaks nothing
+TEST(list_bulk_suit, assign_basic_guarantee) {
+  using alloc = counting_allocator<throwing_copy>;
+  throwing_copy::copies_left = 100;
+  std::vector<throwing_copy> source;
+  for (int i = 0; i < 5; i++) source.emplace_back(i);
+  s21::list<throwing_copy, alloc> s21list(source.begin(), source.begin() + 2);
+  s21::list<throwing_copy, alloc> s21list2(source.begin(), source.end());
+  int live = allocation_counter::live;
+  throwing_copy::copies_left = 3;
+  ASSERT_THROW(s21list = s21list2, std::runtime_error);
+  ASSERT_EQ(allocation_counter::live, live);
+  ASSERT_EQ(s21list.size(), 2U);
+  throwing_copy::copies_left = 1;
+  ASSERT_THROW(s21list.assign(3, source[4]), std::runtime_error);
+  ASSERT_EQ(allocation_counter::live, live);
+  ASSERT_EQ(s21list.size(), 2U);
+  ASSERT_EQ(s21list.front().value, 4);
+  ASSERT_EQ(s21list.back().value, 1);
+}
+
+TEST(list_bulk_suit, assign_reuses_nodes) {
+  using alloc = counting_allocator<int>;
+  s21::list<int, alloc> s21list{1, 2, 3, 4};
+  s21::list<int, alloc> s21list2{5, 6, 7, 8};
+  s21::list<int, alloc>::iterator first = s21list.begin();
+  int live = allocation_counter::live;
+  s21list = s21list2;
+  ASSERT_EQ(allocation_counter::live, live);
+  ASSERT_EQ(s21list.begin(), first);
+  ASSERT_EQ(*first, 5);
+  s21list.assign({9, 10});
+  ASSERT_EQ(allocation_counter::live, live - 2);
+  ASSERT_EQ(s21list.back(), 10);
+  s21list.assign(5, 11);
+  ASSERT_EQ(allocation_counter::live, live + 1);
+  ASSERT_EQ(s21list.size(), 5U);
+  ASSERT_EQ(s21list.begin(), first);
+  for (int value : s21list) ASSERT_EQ(value, 11);
+  ASSERT_EQ(*--s21list.end(), 11);
+}
+
+TEST(list_bulk_suit, assign_pool_allocator) {
+  using pool_list = s21::list<int, s21::node_pool_allocator<int>>;
+  pool_list s21list{1, 2, 3};
+  s21list.assign({4, 5, 6, 7});
+  pool_list s21list2;
+  s21list2 = s21list;
+  s21list2.assign(2, 8);
+  ASSERT_EQ(s21list.size(), 4U);
+  ASSERT_EQ(s21list.back(), 7);
+  ASSERT_EQ(s21list2.size(), 2U);
+  ASSERT_EQ(s21list2.front(), 8);
+}
+
+TEST(list_stats_suit, counting_stats) {
+  using counted_list = s21::list<int, std::allocator<int>, s21::counting_stats>;
+  counted_list s21list{5, 3, 3, 1, 4};
+  s21::list_stats stats = s21list.stats();
+  ASSERT_EQ(stats.allocations, 5U);
+  ASSERT_EQ(stats.peak_size, 5U);
+  s21list.sort();
+  ASSERT_GT(s21list.stats().comparisons, 0U);
+  s21list.reset_stats();
+  s21list.unique();
+  stats = s21list.stats();
+  ASSERT_EQ(stats.comparisons, 4U);
+  ASSERT_EQ(stats.frees, 1U);
+  ASSERT_EQ(stats.node_visits, 5U);
+  counted_list s21list2{2, 6};
+  s21list.merge(s21list2);
+  ASSERT_EQ(s21list.stats().peak_size, 6U);
+  s21list.clear();
+  ASSERT_EQ(s21list.stats().frees, 7U);
+  ASSERT_EQ(s21list.stats().to_json(),
+            "{\"allocations\":0,\"frees\":7,\"node_visits\":11,"
+            "\"comparisons\":9,\"peak_size\":6}");
+}
+
+TEST(list_stats_suit, scans_count_visits) {
+  s21::list<int, std::allocator<int>, s21::counting_stats> s21list{1, 2, 3,
+                                                                   4, 5};
+  int sum = 0;
+  s21list.for_each([&](int value) { sum += value; });
+  ASSERT_EQ(sum, 15);
+  ASSERT_EQ(s21list.stats().node_visits, 5U);
+  ASSERT_TRUE(s21list.find(9) == s21list.end());
+  ASSERT_EQ(s21list.stats().node_visits, 10U);
+
+  // A scan that stops early counts the nodes up to the match
+  s21::list<std::string, std::allocator<std::string>, s21::counting_stats>
+      strings{"a", "b", "c", "d"};
+  ASSERT_EQ(*strings.find("b"), "b");
+  ASSERT_EQ(strings.stats().node_visits, 2U);
+  ASSERT_TRUE(strings.contains("d"));
+  ASSERT_EQ(strings.stats().node_visits, 6U);
+}
+
+TEST(list_stats_suit, disabled_by_default) {
+  s21::list<int> s21list{3, 1, 2};
+  s21list.sort();
+  ASSERT_EQ(s21list.stats().comparisons, 0U);
+  ASSERT_EQ(s21list.stats().to_json(), s21::list_stats().to_json());
+  // The empty policy and the empty default allocator add no storage
+  static_assert(sizeof(s21::list<int>) ==
+                sizeof(s21::list_hook) + sizeof(std::size_t));
+  ASSERT_EQ(sizeof(s21::list<int>) + sizeof(s21::list_stats),
+            sizeof(s21::list<int, std::allocator<int>, s21::counting_stats>));
+}
+
+struct io_record {
+  long long id;
+  double score;
+  char tag[4];
+};
+
+TEST(list_io_suit, save_load) {
+  s21::list<io_record> s21list;
+  for (int i = 0; i < 10000; i++) {
+    s21list.push_back({i, i * 0.5, {'a', 'b', 'c', '\0'}});
+  }
+  std::stringstream stream;
+  s21list.save(stream);
+  s21::list<io_record> s21list2{{-1, 0, {}}};
+  s21list2.load(stream);
+  ASSERT_EQ(s21list2.size(), 10000U);
+  long long expected = 0;
+  for (const io_record& record : s21list2) {
+    ASSERT_EQ(record.id, expected);
+    ASSERT_EQ(record.score, expected * 0.5);
+    ASSERT_STREQ(record.tag, "abc");
+    expected++;
+  }
+  ASSERT_EQ(s21list2.back().id, 9999);
+}
+
+TEST(list_io_suit, load_rejects_bad_input) {
+  s21::list<int> s21list{1, 2, 3};
+  std::stringstream stream;
+  s21list.save(stream);
+  std::string bytes = stream.str();
+
+  s21::list<int> target{7};
+  std::stringstream truncated(bytes.substr(0, bytes.size() - 1));
+  ASSERT_ANY_THROW(target.load(truncated));
+  std::string wrong_version = bytes;
+  wrong_version[4] = 2;
+  std::stringstream versioned(wrong_version);
+  ASSERT_ANY_THROW(target.load(versioned));
+  std::stringstream wrong_type(bytes);
+  s21::list<long long> other;
+  ASSERT_ANY_THROW(other.load(wrong_type));
+  std::stringstream empty;
+  ASSERT_ANY_THROW(target.load(empty));
+  ASSERT_EQ(target.size(), 1U);
+  ASSERT_EQ(target.front(), 7);
+
+  std::stringstream good(bytes);
+  target.load(good);
+  ASSERT_EQ(target.size(), 3U);
+  ASSERT_EQ(target.back(), 3);
+}
+
+TEST(list_io_suit, load_mapped) {
+  const std::string path = "list_io_test.bin";
+  s21::list<int> s21list;
+  for (int i = 0; i < 100000; i++) s21list.push_back(i * 3);
+  {
+    std::ofstream file(path, std::ios::binary);
+    s21list.save(file);
+  }
+  s21::list<int, s21::node_pool_allocator<int>> s21list2{5};
+  s21list2.load_mapped(path);
+  ASSERT_EQ(s21list2.size(), 100000U);
+  int expected = 0;
+  for (int value : s21list2) {
+    ASSERT_EQ(value, expected);
+    expected += 3;
+  }
+  {
+    std::ofstream file(path, std::ios::binary);
+    file << "S21L";
+  }
+  ASSERT_ANY_THROW(s21list2.load_mapped(path));
+  ASSERT_EQ(s21list2.size(), 100000U);
+  std::remove(path.c_str());
+  ASSERT_ANY_THROW(s21list2.load_mapped(path));
+  s21::list<int> empty;
+  std::stringstream stream;
+  empty.save(stream);
+  s21list2.load(stream);
+  ASSERT_TRUE(s21list2.empty());
+}
+
+// A walk over a compacted list visits ascending addresses
+template <typename List>
+bool address_ordered(const List& list) {
+  const void* previous = nullptr;
+  for (const auto& item : list) {
+    if (previous && !std::less<const void*>()(previous, &item)) return false;
+    previous = &item;
+  }
+  return true;
+}
+
+// Erases every other element and reinserts as many at the front, so the
+// new nodes land in the holes
+template <typename List>
+void churn(List& list, int n) {
+  for (int i = 0; i < n; i++) list.push_back(i);
+  auto it = list.begin();
+  while (it != list.end()) {
+    auto next = it;
+    ++next;
+    list.erase(it);
+    it = next;
+    if (it != list.end()) ++it;
+  }
+  for (int i = 0; i < n / 2; i++) list.push_front(n + i);
+}
+
+TEST(list_compact_suit, compact) {
+  s21::list<long> s21list;
+  churn(s21list, 300);
+  std::vector<long> before(s21list.begin(), s21list.end());
+  s21list.compact();
+  ASSERT_EQ(std::vector<long>(s21list.begin(), s21list.end()), before);
+  ASSERT_TRUE(address_ordered(s21list));
+  s21::list<long> empty;
+  empty.compact();
+  ASSERT_TRUE(empty.empty());
+}
+
+TEST(list_compact_suit, compact_pool) {
+  using pool_list = s21::list<int, s21::node_pool_allocator<int>>;
+  pool_list owned;
+  churn(owned, 300);
+  ASSERT_FALSE(address_ordered(owned));
+  std::vector<int> before(owned.begin(), owned.end());
+  owned.compact();
+  ASSERT_EQ(std::vector<int>(owned.begin(), owned.end()), before);
+  ASSERT_TRUE(address_ordered(owned));
+  // With a shared pool the nodes stay where they are
+  s21::node_pool_allocator<int> pool;
+  pool_list shared(pool);
+  pool_list neighbour(pool);
+  neighbour.push_back(1);
+  churn(shared, 100);
+  shared.compact();
+  ASSERT_TRUE(address_ordered(shared));
+  ASSERT_EQ(shared.size(), 100U);
+  ASSERT_EQ(neighbour.front(), 1);
+}
+
+struct throwing_move {
+  explicit throwing_move(int v) : value(v) {}
+  throwing_move(const throwing_move&) = default;
+  throwing_move(throwing_move&& other) noexcept(false) : value(other.value) {}
+  throwing_move& operator=(const throwing_move&) = default;
+  int value;
+};
+
+TEST(list_compact_suit, compact_throwing_move) {
+  s21::list<throwing_move> s21list;
+  for (int i = 0; i < 20; i++) s21list.emplace_back(i);
+  s21list.compact();
+  ASSERT_EQ(s21list.size(), 20U);
+  int expected = 0;
+  for (const throwing_move& item : s21list) ASSERT_EQ(item.value, expected++);
+}
+
+TEST(list_compact_suit, auto_compact) {
+  s21::list<int, s21::node_pool_allocator<int>> s21list;
+  s21list.get_allocator().set_compact_ratio(0.25);
+  for (int i = 0; i < 100; i++) s21list.push_back(i);
+  for (int i = 0; i < 50; i++) s21list.pop_front();
+  for (int i = 0; i < 50; i++) s21list.push_back(-i);
+  ASSERT_FALSE(address_ordered(s21list));
+  ASSERT_TRUE(s21list.get_allocator().wants_compact(s21list.size()));
+  s21list.pop_back();
+  ASSERT_FALSE(address_ordered(s21list));
+  ASSERT_TRUE(s21list.compact_if_needed());  // 50 reused > 0.25 * 99 nodes
+  ASSERT_FALSE(s21list.compact_if_needed());
+  ASSERT_TRUE(address_ordered(s21list));
+  ASSERT_FALSE(s21list.get_allocator().wants_compact(s21list.size()));
+  ASSERT_EQ(s21list.front(), 50);
+  ASSERT_EQ(s21list.back(), -48);
+}
+
+// A compact ratio must not make erase invalidate other iterators
+TEST(list_compact_suit, erase_while_iterating) {
+  s21::list<int, s21::node_pool_allocator<int>> s21list;
+  s21list.get_allocator().set_compact_ratio(0.5);
+  churn(s21list, 200);
+  const int* kept = &*s21list.begin();
+  auto it = s21list.begin();
+  while (it != s21list.end()) {
+    auto next = it;
+    ++next;
+    if (*it % 2 == 0) s21list.erase(it);
+    it = next;
+  }
+  ASSERT_EQ(s21list.size(), 150U);
+  ASSERT_TRUE(s21list.get_allocator().wants_compact(s21list.size()));
+  ASSERT_EQ(*kept, 299);
+  for (int value : s21list) ASSERT_EQ(value % 2, 1);
+  ASSERT_TRUE(s21list.compact_if_needed());
+  ASSERT_TRUE(address_ordered(s21list));
+}
+
+TEST(list_scan_suit, for_each_accumulate) {
+  s21::list<int> s21list;
+  ASSERT_EQ(s21list.accumulate(7), 7);
+  for (int i = 1; i <= 20; i++) s21list.push_back(i);
+  ASSERT_EQ(s21list.accumulate(0), 210);
+  ASSERT_EQ(s21list.accumulate(1LL, std::multiplies<>()) % 1000003,
+            2432902008176640000LL % 1000003);
+  s21list.for_each([](int& value) { value *= 2; });
+  std::vector<int> seen;
+  const s21::list<int>& view = s21list;
+  view.for_each([&seen](const int& value) { seen.push_back(value); });
+  ASSERT_EQ(seen.size(), 20U);
+  ASSERT_EQ(seen.front(), 2);
+  ASSERT_EQ(seen.back(), 40);
+  ASSERT_TRUE(std::is_sorted(seen.begin(), seen.end()));
+}
+
+TEST(list_scan_suit, find_if) {
+  s21::list<int> s21list = {4, 8, 15, 16, 23, 42};
+  s21::list<int>::iterator odd =
+      s21list.find_if([](int value) { return value % 2; });
+  ASSERT_EQ(*odd, 15);
+  *odd = 14;
+  const s21::list<int>& view = s21list;
+  ASSERT_EQ(*view.find_if([](int value) { return value % 2; }), 23);
+  ASSERT_TRUE(view.find_if([](int value) { return value > 42; }) ==
+              view.end());
+  s21::list<int> empty;
+  ASSERT_TRUE(empty.find_if([](int) { return true; }) == empty.end());
+}
+
+TEST(list_scan_suit, for_each_batch) {
+  s21::list<int> s21list;
+  for (int i = 0; i < 10; i++) s21list.push_back(i);
+  std::vector<std::size_t> counts;
+  int next = 0;
+  s21list.for_each_batch(4, [&](int* const* items, std::size_t count) {
+    counts.push_back(count);
+    for (std::size_t i = 0; i < count; i++) ASSERT_EQ(*items[i], next++);
+    for (std::size_t i = 0; i < count; i++) *items[i] = -*items[i];
+  });
+  ASSERT_EQ(counts, std::vector<std::size_t>({4, 4, 2}));
+  ASSERT_EQ(s21list.back(), -9);
+  counts.clear();
+  const s21::list<int>& view = s21list;
+  view.for_each_batch(0, [&](const int* const*, std::size_t count) {
+    counts.push_back(count);
+  });
+  ASSERT_EQ(counts.size(), 10U);
+  counts.clear();
+  view.for_each_batch(1000, [&](const int* const*, std::size_t count) {
+    counts.push_back(count);
+  });
+  ASSERT_EQ(counts, std::vector<std::size_t>({10}));
+}
+
+// Sizes around the 64-value blocks and the vector widths of the kernels
+TEST(list_search_suit, find_count_contains) {
+  for (int n : {0, 1, 7, 31, 64, 65, 130}) {
+    s21::list<int> s21list;
+    for (int i = 0; i < n; i++) s21list.push_back(i % 10);
+    const int threes = n / 10 + (n % 10 > 3);
+    ASSERT_EQ(s21list.count(3), static_cast<std::size_t>(threes));
+    ASSERT_EQ(s21list.contains(9), n > 9);
+    ASSERT_FALSE(s21list.contains(10));
+    ASSERT_TRUE(s21list.find(10) == s21list.end());
+  }
+  s21::list<int> s21list;
+  for (int i = 0; i < 200; i++) s21list.push_back(i);
+  for (int i : {0, 15, 63, 64, 127, 199}) ASSERT_EQ(*s21list.find(i), i);
+  *s21list.find(150) = -1;
+  ASSERT_EQ(*++s21list.find(-1), 151);
+  const s21::list<int>& view = s21list;
+  ASSERT_EQ(*view.find(-1), -1);
+}
+
+TEST(list_search_suit, narrow_and_floating_types) {
+  s21::list<char> chars;
+  for (int i = 0; i < 1000; i++) chars.push_back(i % 2 ? 'a' : 'b');
+  ASSERT_EQ(chars.count('a'), 500U);
+  ASSERT_EQ(chars.min(), 'a');
+  ASSERT_EQ(chars.max(), 'b');
+  s21::list<double> doubles = {0.5, -2.25, 8.0, 3.0, -0.0};
+  for (int i = 0; i < 100; i++) doubles.push_back(i / 100.0);
+  ASSERT_DOUBLE_EQ(doubles.min(), -2.25);
+  ASSERT_DOUBLE_EQ(doubles.max(), 8.0);
+  ASSERT_EQ(doubles.count(0.0), 2U);
+  ASSERT_TRUE(doubles.contains(0.99));
+  s21::list<std::uint64_t> wide = {5, 1ULL << 63, 7};
+  ASSERT_EQ(wide.max(), 1ULL << 63);
+  ASSERT_EQ(wide.min(), 5U);
+  ASSERT_ANY_THROW(s21::list<float>().min());
+}
+
+TEST(list_search_suit, min_max_position) {
+  for (int at : {0, 5, 63, 64, 99}) {
+    s21::list<int> s21list;
+    for (int i = 0; i < 100; i++) s21list.push_back(i == at ? -5 : i % 7);
+    ASSERT_EQ(s21list.min(), -5);
+    ASSERT_EQ(s21list.max(), 6);
+  }
+}
+
+TEST(list_search_suit, equality) {
+  s21::list<int> a;
+  s21::list<int> b;
+  ASSERT_TRUE(a == b);
+  for (int i = 0; i < 150; i++) {
+    a.push_back(i);
+    b.push_back(i);
+  }
+  ASSERT_TRUE(a == b);
+  b.pop_back();
+  b.push_back(0);
+  ASSERT_TRUE(a != b);
+  b.pop_back();
+  b.push_back(149);
+  b.push_back(150);
+  ASSERT_FALSE(a == b);
+  s21::list<float> nan = {std::numeric_limits<float>::quiet_NaN()};
+  ASSERT_FALSE(nan == nan);
+  s21::list<std::string> words = {"a", "bb", "a"};
+  ASSERT_TRUE(words == s21::list<std::string>({"a", "bb", "a"}));
+  ASSERT_EQ(words.count("a"), 2U);
+  ASSERT_EQ(*++words.find("bb"), "a");
+  ASSERT_EQ(words.max(), "bb");
+}
+
+#ifdef S21_LIST_HAS_VECTOR
+// The list picks one kernel width at run time; check the 16-byte build
+// against the scalar loops too
+TEST(list_search_suit, sse_kernels) {
+  using kernels = s21::detail::vector_kernels<16, short>;
+  std::vector<short> values(70);
+  for (std::size_t i = 0; i < values.size(); i++) {
+    values[i] = static_cast<short>(i % 9 - 4);
+  }
+  for (std::size_t n = 0; n <= values.size(); n++) {
+    const short* data = values.data();
+    ASSERT_EQ(kernels::find(data, n, 4), s21::detail::scalar_find(data, n,
+                                                                  short(4)));
+    ASSERT_EQ(kernels::count(data, n, -4),
+              s21::detail::scalar_count(data, n, short(-4)));
+    ASSERT_EQ(kernels::extreme<true>(data, n, 0),
+              s21::detail::scalar_extreme<true>(data, n, short(0)));
+    ASSERT_TRUE(kernels::equal(data, data, n));
+  }
+  std::vector<short> other = values;
+  other[66] = 100;
+  ASSERT_FALSE(kernels::equal(values.data(), other.data(), 70));
+  ASSERT_EQ(kernels::extreme<false>(other.data(), 70, 0), 100);
+}
+#endif
+
+TEST(list_node_handle_suit, extract_insert) {
+  copy_counter::copies = 0;
+  s21::list<copy_counter> from;
+  s21::list<copy_counter> to;
+  for (int i = 0; i < 3; i++) from.emplace_back(i);
+  to.emplace_back(10);
+  const copy_counter* address = &*++from.begin();
+  s21::list<copy_counter>::node_type handle = from.extract(++from.begin());
+  ASSERT_FALSE(handle.empty());
+  ASSERT_EQ(from.size(), 2U);
+  ASSERT_EQ(handle.value().value, 1);
+  handle.value().value = 11;
+  s21::list<copy_counter>::iterator it =
+      to.insert(to.begin(), std::move(handle));
+  ASSERT_TRUE(handle.empty());
+  ASSERT_FALSE(handle);
+  ASSERT_EQ(&*it, address);
+  ASSERT_EQ(to.size(), 2U);
+  ASSERT_EQ(to.front().value, 11);
+  ASSERT_EQ(to.back().value, 10);
+  ASSERT_EQ(from.back().value, 2);
+  ASSERT_EQ(copy_counter::copies, 0);
+  ASSERT_TRUE(to.insert(to.end(), std::move(handle)) == to.end());
+  ASSERT_ANY_THROW(from.extract(from.end()));
+}
+
+TEST(list_node_handle_suit, dropped_handle) {
+  auto owned = std::make_shared<int>(7);
+  s21::list<std::shared_ptr<int>> s21list;
+  s21list.push_back(owned);
+  s21list.push_back(owned);
+  {
+    auto handle = s21list.extract(s21list.begin());
+    ASSERT_EQ(owned.use_count(), 3);
+    decltype(handle) moved(std::move(handle));
+    ASSERT_EQ(*moved.value(), 7);
+    moved = s21list.extract(s21list.begin());
+    ASSERT_EQ(owned.use_count(), 2);
+  }
+  ASSERT_EQ(owned.use_count(), 1);
+  ASSERT_TRUE(s21list.empty());
+}
+
+TEST(list_node_handle_suit, pools) {
+  using pool_list = s21::list<std::unique_ptr<int>,
+                              s21::node_pool_allocator<std::unique_ptr<int>>>;
+  pool_list a;
+  pool_list b(a.get_allocator());
+  pool_list c;
+  a.push_back(std::make_unique<int>(1));
+  a.push_back(std::make_unique<int>(2));
+  const std::unique_ptr<int>* address = &a.front();
+  b.insert(b.end(), a.extract(a.begin()));
+  ASSERT_EQ(&b.front(), address);
+  auto handle = a.extract(a.begin());
+  ASSERT_TRUE(a.empty());
+  pool_list::iterator moved = c.insert(c.end(), std::move(handle));
+  ASSERT_TRUE(handle.empty());
+  ASSERT_EQ(**moved, 2);
+  ASSERT_EQ(*b.front(), 1);
+}
+
+// Counts what passes through to the upstream resource
+class counting_resource : public std::pmr::memory_resource {
+ public:
+  int allocations = 0;
+  int frees = 0;
+
+ private:
+  void* do_allocate(std::size_t bytes, std::size_t align) override {
+    allocations++;
+    return std::pmr::new_delete_resource()->allocate(bytes, align);
+  }
+  void do_deallocate(void* p, std::size_t bytes, std::size_t align) override {
+    frees++;
+    std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+  }
+  bool do_is_equal(const memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+};
+
+// A monotonic resource that counts the frees it is handed
+struct counting_monotonic : std::pmr::monotonic_buffer_resource {
+  int frees = 0;
+
+ private:
+  void do_deallocate(void* p, std::size_t bytes, std::size_t align) override {
+    frees++;
+    monotonic_buffer_resource::do_deallocate(p, bytes, align);
+  }
+};
+
+TEST(list_pmr_suit, allocations) {
+  counting_resource resource;
+  {
+    s21::pmr::list<int> s21list(&resource);
+    s21list.push_back(1);
+    s21list.push_front(0);
+    s21list.insert(s21list.end(), 3);
+    s21list.emplace(--s21list.end(), 2);
+    s21list.emplace_back(4);
+    ASSERT_EQ(resource.allocations, 5);
+    ASSERT_EQ(s21list.get_allocator().resource(), &resource);
+    s21list.pop_front();
+    ASSERT_EQ(resource.frees, 1);
+    ASSERT_EQ(s21list, s21::pmr::list<int>({1, 2, 3, 4}));
+  }
+  ASSERT_EQ(resource.frees, 5);
+}
+
+TEST(list_pmr_suit, monotonic_skips_frees) {
+  std::pmr::monotonic_buffer_resource monotonic;
+  counting_monotonic counting;
+  ASSERT_TRUE(s21::detail::deallocate_is_noop(
+      std::pmr::polymorphic_allocator<int>(&monotonic)));
+  ASSERT_FALSE(s21::detail::deallocate_is_noop(
+      std::pmr::polymorphic_allocator<int>(&counting)));
+  ASSERT_FALSE(s21::detail::deallocate_is_noop(std::allocator<int>()));
+
+  s21::pmr::list<int> numbers(&monotonic);
+  for (int i = 0; i < 100; i++) numbers.push_back(i);
+  numbers.clear();
+  ASSERT_TRUE(numbers.empty());
+  numbers.push_back(5);
+  ASSERT_EQ(numbers, s21::pmr::list<int>({5}));
+}
+
+TEST(list_pmr_suit, monotonic_subclass_frees) {
+  counting_monotonic resource;
+  {
+    s21::pmr::list<int> numbers(&resource);
+    s21::pmr::list<std::string> words(&resource);
+    for (int i = 0; i < 100; i++) {
+      numbers.push_back(i);
+      words.push_back(std::to_string(i));
+    }
+    numbers.pop_back();
+    ASSERT_EQ(resource.frees, 1);
+    // The subclass may act on frees, so clear still hands every node back
+    numbers.clear();
+    ASSERT_TRUE(numbers.empty());
+    ASSERT_EQ(resource.frees, 100);
+    numbers.push_back(5);
+    ASSERT_EQ(numbers.front(), 5);
+  }
+  ASSERT_EQ(resource.frees, 201);
+}
+
+TEST(list_pmr_suit, swap_move_across_resources) {
+  counting_resource first;
+  counting_resource second;
+  s21::pmr::list<std::string> a(&first);
+  s21::pmr::list<std::string> b(&second);
+  a.push_back("a");
+  a.push_back("b");
+  b.push_back("c");
+  ASSERT_EQ(first.allocations, 2);
+  a.swap(b);
+  ASSERT_EQ(a, s21::pmr::list<std::string>({"c"}));
+  ASSERT_EQ(b, s21::pmr::list<std::string>({"a", "b"}));
+  ASSERT_EQ(a.get_allocator().resource(), &first);
+  ASSERT_EQ(first.allocations - first.frees, 1);
+  ASSERT_EQ(second.allocations - second.frees, 2);
+  a = std::move(b);
+  ASSERT_TRUE(b.empty());
+  ASSERT_EQ(a.size(), 2U);
+  ASSERT_EQ(first.allocations - first.frees, 2);
+  ASSERT_EQ(second.allocations - second.frees, 0);
+  s21::pmr::list<std::string> moved(std::move(a));
+  ASSERT_EQ(moved.get_allocator().resource(), &first);
+  ASSERT_EQ(moved.back(), "b");
+}
+
+TEST(list_pmr_suit, pool_resource) {
+  std::pmr::unsynchronized_pool_resource pool;
+  s21::pmr::list<int> s21list(&pool);
+  for (int round = 0; round < 10; round++) {
+    for (int i = 0; i < 100; i++) s21list.push_back(i);
+    s21list.remove_if([](int value) { return value % 3; });
+    s21list.sort();
+    s21list.unique();
+  }
+  ASSERT_EQ(s21list.size(), 34U);
+  ASSERT_EQ(s21list.back(), 99);
+}
+
+// Every modifier that does not copy by definition must work for move-only
+// and non-default-constructible T and never copy a value.
+struct move_only_key {
+  explicit move_only_key(int v) : value(v) {}
+  move_only_key(const move_only_key&) = delete;
+  move_only_key(move_only_key&&) = default;
+  move_only_key& operator=(const move_only_key&) = delete;
+  move_only_key& operator=(move_only_key&&) = default;
+  int value;
+};
+
+template <typename T>
+struct move_traits {  // copy_counter and move_only_key
+  static T make(int v) { return T(v); }
+  static int key(const T& item) { return item.value; }
+};
+
+template <>
+struct move_traits<std::unique_ptr<int>> {
+  static std::unique_ptr<int> make(int v) { return std::make_unique<int>(v); }
+  static int key(const std::unique_ptr<int>& item) { return *item; }
+};
+
+template <typename T>
+class list_move_suit : public ::testing::Test {
+ protected:
+  using traits = move_traits<T>;
+
+  void SetUp() override { copy_counter::copies = 0; }
+  void TearDown() override { ASSERT_EQ(copy_counter::copies, 0); }
+
+  static s21::list<T> make_list(std::initializer_list<int> keys) {
+    s21::list<T> result;
+    for (int k : keys) result.push_back(traits::make(k));
+    return result;
+  }
+  static std::vector<int> keys(const s21::list<T>& list) {
+    std::vector<int> result;
+    for (const T& item : list) result.push_back(traits::key(item));
+    return result;
+  }
+  static bool less(const T& a, const T& b) {
+    return traits::key(a) < traits::key(b);
+  }
+  static bool equal(const T& a, const T& b) {
+    return traits::key(a) == traits::key(b);
+  }
+};
+
+using move_types =
+    ::testing::Types<std::unique_ptr<int>, move_only_key, copy_counter>;
+TYPED_TEST_SUITE(list_move_suit, move_types);
+
+TYPED_TEST(list_move_suit, insert_erase) {
+  using traits = move_traits<TypeParam>;
+  s21::list<TypeParam> list;
+  list.push_back(traits::make(2));
+  list.push_front(traits::make(0));
+  list.insert(++list.begin(), traits::make(1));
+  list.emplace_back(traits::make(4));
+  list.emplace(--list.end(), traits::make(3));
+  list.emplace_front(traits::make(-1));
+  ASSERT_EQ(this->keys(list), std::vector<int>({-1, 0, 1, 2, 3, 4}));
+  list.pop_front();
+  list.pop_back();
+  list.erase(++list.begin());
+  ASSERT_EQ(this->keys(list), std::vector<int>({0, 2, 3}));
+  s21::list<TypeParam> moved(std::move(list));
+  ASSERT_TRUE(list.empty());
+  list = std::move(moved);
+  list.swap(moved);
+  ASSERT_EQ(this->keys(moved), std::vector<int>({0, 2, 3}));
+  moved.clear();
+  ASSERT_TRUE(moved.empty());
+}
+
+TYPED_TEST(list_move_suit, sort_merge) {
+  auto list = this->make_list({5, 3, 9, 1});
+  auto other = this->make_list({8, 2, 6});
+  list.sort(this->less);
+  other.sort(this->less);
+  list.merge(other, this->less);
+  ASSERT_TRUE(other.empty());
+  ASSERT_EQ(this->keys(list), std::vector<int>({1, 2, 3, 5, 6, 8, 9}));
+  list.reverse();
+  list.sort(s21::execution::par.with_threads(2), this->less);
+  ASSERT_EQ(this->keys(list), std::vector<int>({1, 2, 3, 5, 6, 8, 9}));
+}
+
+TYPED_TEST(list_move_suit, splice) {
+  auto list = this->make_list({1, 2});
+  auto other = this->make_list({3, 4, 5, 6});
+  list.splice(list.end(), other, other.begin());
+  list.splice(list.begin(), other, ++other.begin(), other.end());
+  ASSERT_EQ(this->keys(list), std::vector<int>({5, 6, 1, 2, 3}));
+  list.splice(list.end(), other);
+  ASSERT_TRUE(other.empty());
+  ASSERT_EQ(this->keys(list), std::vector<int>({5, 6, 1, 2, 3, 4}));
+}
+
+TYPED_TEST(list_move_suit, remove_unique_dedupe) {
+  using traits = move_traits<TypeParam>;
+  auto list = this->make_list({1, 1, 2, 7, 2, 2, 3, 1, 8});
+  list.unique(this->equal);
+  ASSERT_EQ(this->keys(list), std::vector<int>({1, 2, 7, 2, 3, 1, 8}));
+  list.remove_if([](const TypeParam& item) { return traits::key(item) > 6; });
+  list.dedupe([](const TypeParam& item) { return traits::key(item); },
+              this->equal);
+  ASSERT_EQ(this->keys(list), std::vector<int>({1, 2, 3}));
+}
+
 // Oleg
 TEST(ALL, remains) {
   s21::list<int> example{3, 10, 2000};
@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "s21_small_list.h"
+
+namespace {
+
+template <typename T, std::size_t N>
+std::vector<T> values(const s21::small_list<T, N>& list) {
+  return std::vector<T>(list.begin(), list.end());
+}
+
+// True if the element is stored in the inline array of list
+template <typename T, std::size_t N>
+bool is_inline(const s21::small_list<T, N>& list, const T& item) {
+  auto begin = reinterpret_cast<std::uintptr_t>(&list);
+  auto address = reinterpret_cast<std::uintptr_t>(&item);
+  return address >= begin && address < begin + sizeof(list);
+}
+
+#if __cplusplus >= 202002L
+constexpr int constexpr_sum() {
+  s21::small_list<int, 4> list{3, 1, 2};
+  list.push_front(7);
+  list.push_back(9);  // spills to the heap
+  list.pop_front();
+  list.reverse();
+  int sum = 0;
+  for (int item : list) sum = sum * 10 + item;
+  return sum;
+}
+static_assert(constexpr_sum() == 9213, "small_list is usable in constexpr");
+#endif
+
+}  // namespace
+
+TEST(small_list_suit, constructors) {
+  s21::small_list<int, 4> list{1, 2, 3};
+  ASSERT_EQ(values(list), std::vector<int>({1, 2, 3}));
+  s21::small_list<int, 4> copy(list);
+  ASSERT_EQ(values(copy), std::vector<int>({1, 2, 3}));
+  s21::small_list<int, 4> moved(std::move(copy));
+  ASSERT_TRUE(copy.empty());
+  ASSERT_EQ(values(moved), std::vector<int>({1, 2, 3}));
+  s21::small_list<int, 4> sized(6, 5);
+  ASSERT_EQ(values(sized), std::vector<int>(6, 5));
+  sized = list;
+  ASSERT_EQ(values(sized), std::vector<int>({1, 2, 3}));
+  std::vector<int> source{4, 5, 6, 7, 8};
+  s21::small_list<int, 4> ranged(source.begin(), source.end());
+  ASSERT_EQ(values(ranged), source);
+  ranged = std::move(list);
+  ASSERT_TRUE(list.empty());
+  ASSERT_EQ(values(ranged), std::vector<int>({1, 2, 3}));
+  ASSERT_EQ((s21::small_list<int, 4>::inline_capacity()), 4U);
+}
+
+TEST(small_list_suit, inline_then_heap) {
+  s21::small_list<std::string, 3> list;
+  ASSERT_ANY_THROW(list.front());
+  ASSERT_ANY_THROW(list.pop_back());
+  for (int i = 0; i < 5; i++) list.push_back(std::to_string(i));
+  auto it = list.begin();
+  for (int i = 0; i < 5; i++, ++it) {
+    ASSERT_EQ(is_inline(list, *it), i < 3);
+  }
+  // An erased inline node is handed out again before the heap
+  list.erase(list.begin());
+  list.push_front("x");
+  ASSERT_TRUE(is_inline(list, list.front()));
+  list.pop_back();
+  list.pop_back();
+  ASSERT_EQ(values(list), std::vector<std::string>({"x", "1", "2"}));
+  list.clear();
+  ASSERT_TRUE(list.empty());
+  list.push_back("y");
+  ASSERT_TRUE(is_inline(list, list.back()));
+}
+
+TEST(small_list_suit, modifiers) {
+  s21::small_list<int, 4> list{5, 1, 4};
+  auto pos = list.begin();
+  ++pos;
+  list.insert(pos, 9);
+  list.emplace_front(1);
+  ASSERT_EQ(values(list), std::vector<int>({1, 5, 9, 1, 4}));
+  list.sort();
+  ASSERT_EQ(values(list), std::vector<int>({1, 1, 4, 5, 9}));
+  list.unique();
+  list.reverse();
+  ASSERT_EQ(values(list), std::vector<int>({9, 5, 4, 1}));
+  ASSERT_ANY_THROW(list.erase(list.end()));
+}
+
+TEST(small_list_suit, const_iterator) {
+  using list = s21::small_list<int, 4>;
+  static_assert(std::is_convertible_v<list::iterator, list::const_iterator>);
+  static_assert(
+      !std::is_convertible_v<list::const_iterator, list::iterator>);
+  static_assert(
+      std::is_same_v<decltype(*std::declval<list::const_iterator>()),
+                     const int&>);
+  list small{1, 2, 3, 4, 5};
+  const list& view = small;
+  list::const_iterator it = view.begin();
+  ASSERT_EQ(*++it, 2);
+  ASSERT_EQ(*it--, 2);
+  ASSERT_TRUE(it == small.begin());
+  ASSERT_TRUE(small.begin() == it);
+  ASSERT_TRUE(--view.end() != it);
+  ASSERT_EQ(*--view.end(), 5);
+  small.insert(++it, 9);
+  small.erase(--view.end());
+  ASSERT_EQ(values(small), std::vector<int>({1, 9, 2, 3, 4}));
+}
+
+TEST(small_list_suit, transfer) {
+  s21::small_list<std::unique_ptr<int>, 2> left;
+  s21::small_list<std::unique_ptr<int>, 2> right;
+  for (int i = 0; i < 4; i++) {
+    left.push_back(std::make_unique<int>(2 * i));
+    right.push_back(std::make_unique<int>(2 * i + 1));
+  }
+  left.merge(right, [](const std::unique_ptr<int>& a,
+                       const std::unique_ptr<int>& b) { return *a < *b; });
+  ASSERT_TRUE(right.empty());
+  ASSERT_EQ(left.size(), 8U);
+  int expected = 0;
+  for (const auto& item : left) ASSERT_EQ(*item, expected++);
+  right.push_back(std::make_unique<int>(-1));
+  left.splice(left.begin(), right);
+  ASSERT_EQ(*left.front(), -1);
+  left.swap(right);
+  ASSERT_TRUE(left.empty());
+  ASSERT_EQ(right.size(), 9U);
+  ASSERT_EQ(*right.back(), 7);
+}
@@ -0,0 +1,261 @@
+#include <gtest/gtest.h>
+
+#include <list>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "s21_unrolled_list.h"
+
+// Small blocks so that every test crosses block boundaries
+template <typename T>
+using small_unrolled = s21::unrolled_list<T, 4>;
+
+template <typename T, typename List>
+void expect_same(List& s21list, const std::list<T>& stdlist) {
+  ASSERT_EQ(s21list.size(), stdlist.size());
+  auto stdit = stdlist.begin();
+  for (auto s21it = s21list.begin(); s21it != s21list.end(); ++s21it) {
+    ASSERT_EQ(*s21it, *stdit);
+    ++stdit;
+  }
+  ASSERT_TRUE(stdit == stdlist.end());
+}
+
+TEST(unrolled_constructor_suit, constructors) {
+  small_unrolled<int> s21list{66, 44, 0, 97, 2142, 5, 3};
+  std::list<int> stdlist{66, 44, 0, 97, 2142, 5, 3};
+  expect_same(s21list, stdlist);
+  small_unrolled<int> copy(s21list);
+  expect_same(copy, stdlist);
+  small_unrolled<int> moved(std::move(copy));
+  expect_same(moved, stdlist);
+  ASSERT_TRUE(copy.empty());
+  small_unrolled<int> sized(9);
+  expect_same(sized, std::list<int>(9));
+  sized = s21list;
+  expect_same(sized, stdlist);
+  ASSERT_EQ(s21::unrolled_list<int>::block_capacity(), 64U);
+}
+
+TEST(unrolled_push_pop_suit, push_pop) {
+  small_unrolled<int> s21list;
+  std::list<int> stdlist;
+  ASSERT_ANY_THROW(s21list.front());
+  ASSERT_ANY_THROW(s21list.pop_back());
+  ASSERT_ANY_THROW(s21list.pop_front());
+  for (int i = 0; i < 50; i++) {
+    s21list.push_back(i);
+    stdlist.push_back(i);
+    s21list.push_front(-i);
+    stdlist.push_front(-i);
+  }
+  expect_same(s21list, stdlist);
+  for (int i = 0; i < 30; i++) {
+    s21list.pop_front();
+    stdlist.pop_front();
+    s21list.pop_back();
+    stdlist.pop_back();
+  }
+  ASSERT_EQ(s21list.front(), stdlist.front());
+  ASSERT_EQ(s21list.back(), stdlist.back());
+  expect_same(s21list, stdlist);
+}
+
+TEST(unrolled_function_suit, insert_erase) {
+  small_unrolled<std::string> s21list;
+  std::list<std::string> stdlist;
+  unsigned seed = 7;
+  for (int i = 0; i < 400; i++) {
+    seed = seed * 1103515245 + 12345;
+    size_t at = stdlist.empty() ? 0 : (seed >> 8) % (stdlist.size() + 1);
+    auto s21it = s21list.begin();
+    auto stdit = stdlist.begin();
+    for (size_t j = 0; j < at; j++) {
+      ++s21it;
+      ++stdit;
+    }
+    if (i % 3 == 2 && at < stdlist.size()) {
+      s21it = s21list.erase(s21it);
+      stdit = stdlist.erase(stdit);
+      if (stdit != stdlist.end()) {
+        ASSERT_EQ(*s21it, *stdit);
+      }
+    } else {
+      std::string value = "value_" + std::to_string(i);
+      s21it = s21list.insert(s21it, value);
+      stdit = stdlist.insert(stdit, value);
+      ASSERT_EQ(*s21it, *stdit);
+    }
+  }
+  expect_same(s21list, stdlist);
+  ASSERT_ANY_THROW(s21list.erase(s21list.end()));
+}
+
+TEST(unrolled_function_suit, emplace) {
+  small_unrolled<std::string> s21list;
+  std::list<std::string> stdlist;
+  s21list.emplace_back(3, 'a');
+  stdlist.emplace_back(3, 'a');
+  s21list.emplace_front("rdontos");
+  stdlist.emplace_front("rdontos");
+  s21list.emplace(++s21list.begin(), "tsherman");
+  stdlist.emplace(++stdlist.begin(), "tsherman");
+  expect_same(s21list, stdlist);
+}
+
+TEST(unrolled_function_suit, sort_merge) {
+  small_unrolled<int> s21list;
+  small_unrolled<int> s21list2;
+  std::list<int> stdlist;
+  std::list<int> stdlist2;
+  unsigned seed = 42;
+  for (int i = 0; i < 300; i++) {
+    seed = seed * 1103515245 + 12345;
+    int value = static_cast<int>((seed >> 8) % 1000);
+    (i % 3 ? s21list : s21list2).push_back(value);
+    (i % 3 ? stdlist : stdlist2).push_back(value);
+  }
+  s21list.sort();
+  stdlist.sort();
+  expect_same(s21list, stdlist);
+  s21list2.sort(std::greater<int>());
+  stdlist2.sort(std::greater<int>());
+  expect_same(s21list2, stdlist2);
+  s21list2.sort();
+  stdlist2.sort();
+  s21list.merge(s21list2);
+  stdlist.merge(stdlist2);
+  expect_same(s21list, stdlist);
+  ASSERT_TRUE(s21list2.empty());
+}
+
+TEST(unrolled_function_suit, unique_reverse) {
+  small_unrolled<int> s21list{1, 1, 1, 1, 222, 222, 2, 33, 3, 3, 3, 4};
+  std::list<int> stdlist{1, 1, 1, 1, 222, 222, 2, 33, 3, 3, 3, 4};
+  s21list.unique();
+  stdlist.unique();
+  expect_same(s21list, stdlist);
+  s21list.reverse();
+  stdlist.reverse();
+  expect_same(s21list, stdlist);
+  s21list.push_back(99);
+  stdlist.push_back(99);
+  ASSERT_EQ(s21list.back(), stdlist.back());
+  auto s21it = s21list.end();
+  auto stdit = stdlist.end();
+  for (size_t i = 0; i < stdlist.size(); i++) {
+    --s21it;
+    --stdit;
+    ASSERT_EQ(*s21it, *stdit);
+  }
+}
+
+TEST(unrolled_function_suit, splice_swap) {
+  small_unrolled<int> s21list{66, 44, 0, 97, 2142};
+  small_unrolled<int> s21list2{5, 3, 8, 13, 21, 34};
+  std::list<int> stdlist{66, 44, 0, 97, 2142};
+  std::list<int> stdlist2{5, 3, 8, 13, 21, 34};
+  s21list.splice(++(++s21list.begin()), s21list2);
+  stdlist.splice(++(++stdlist.begin()), stdlist2);
+  expect_same(s21list, stdlist);
+  ASSERT_TRUE(s21list2.empty());
+  s21list2.push_back(1);
+  stdlist2.push_back(1);
+  s21list.swap(s21list2);
+  stdlist.swap(stdlist2);
+  expect_same(s21list, stdlist);
+  expect_same(s21list2, stdlist2);
+}
+
+// Elements per block, read off the iterators
+template <typename List>
+std::vector<std::size_t> occupancy(List& list) {
+  std::vector<std::size_t> counts;
+  const void* current = nullptr;
+  for (auto it = list.begin(); it != list.end(); ++it) {
+    if (it.n_block != current) counts.push_back(0);
+    current = it.n_block;
+    counts.back()++;
+  }
+  return counts;
+}
+
+TEST(unrolled_function_suit, sparse_erase_occupancy) {
+  s21::unrolled_list<int, 64> s21list;
+  std::list<int> stdlist;
+  for (int i = 0; i < 6400; i++) s21list.push_back(i);
+  for (auto it = s21list.begin(); it != s21list.end();) {
+    it = *it % 64 ? s21list.erase(it) : ++it;
+  }
+  for (int i = 0; i < 6400; i += 64) stdlist.push_back(i);
+  expect_same(s21list, stdlist);
+  std::vector<std::size_t> counts = occupancy(s21list);
+  ASSERT_LE(counts.size(), 4U);
+  for (std::size_t count : counts) ASSERT_GE(count, 32U);
+
+  while (s21list.size() > 40) {
+    s21list.pop_back();
+    s21list.pop_front();
+    stdlist.pop_back();
+    stdlist.pop_front();
+    for (std::size_t count : occupancy(s21list)) ASSERT_GE(count, 32U);
+  }
+  expect_same(s21list, stdlist);
+}
+
+TEST(unrolled_function_suit, erase_borrows) {
+  small_unrolled<std::string> s21list;
+  std::list<std::string> stdlist;
+  for (int i = 0; i < 40; i++) {
+    s21list.push_back(std::to_string(i));
+    stdlist.push_back(std::to_string(i));
+  }
+  for (int round = 0; round < 30; round++) {
+    auto s21it = s21list.begin();
+    auto stdit = stdlist.begin();
+    for (int i = 0; i < round * 7 % static_cast<int>(stdlist.size()); i++) {
+      ++s21it;
+      ++stdit;
+    }
+    auto next = s21list.erase(s21it);
+    auto stdnext = stdlist.erase(stdit);
+    if (stdnext != stdlist.end()) {
+      ASSERT_EQ(*next, *stdnext);
+    }
+    for (std::size_t count : occupancy(s21list)) ASSERT_GE(count, 2U);
+  }
+  expect_same(s21list, stdlist);
+}
+
+TEST(unrolled_iter_suit, const_iteration) {
+  const s21::unrolled_list<int> s21list{66, 44, 0, 97, 2142};
+  std::list<int> stdlist{66, 44, 0, 97, 2142};
+  auto stdit = stdlist.begin();
+  for (int value : s21list) {
+    ASSERT_EQ(value, *stdit);
+    ++stdit;
+  }
+}
+
+TEST(unrolled_iter_suit, const_iterator) {
+  using list = small_unrolled<int>;
+  static_assert(std::is_convertible_v<list::iterator, list::const_iterator>);
+  static_assert(
+      !std::is_convertible_v<list::const_iterator, list::iterator>);
+  static_assert(
+      std::is_same_v<decltype(*std::declval<list::const_iterator>()),
+                     const int&>);
+  list s21list{1, 2, 3, 4, 5, 6};
+  list::const_iterator it = s21list.begin();
+  for (int i = 0; i < 4; i++) ++it;
+  ASSERT_EQ(*it--, 5);
+  ASSERT_EQ(*it, 4);
+  ASSERT_TRUE(it != s21list.begin());
+  ASSERT_TRUE(s21list.end() != it);
+  s21list.insert(it, 9);
+  list other{7, 8};
+  s21list.splice(s21list.begin(), other);
+  ASSERT_EQ(std::vector<int>(s21list.begin(), s21list.end()),
+            std::vector<int>({7, 8, 1, 2, 3, 9, 4, 5, 6}));
+}